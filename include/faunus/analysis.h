@@ -56,6 +56,7 @@ namespace Faunus
                 virtual string _info();  //!< info all classes must provide
                 virtual Tmjson _json();   //!< result of analysis as json object
                 virtual void _test( UnitTest & );
+                virtual bool _combine( AnalysisBase & ); //!< add samples from other instance of same type
 
                 int stepcnt;          //!< counter between sampling points
 
@@ -75,6 +76,7 @@ namespace Faunus
                 void test( UnitTest & );//!< Perform unit test
                 void sample();       //!< Sample event.
                 Tmjson json();       //!< Get info and results as json object
+                void combine( AnalysisBase & ); //!< Merge samples from other analysis of same type
         };
 
         /**
@@ -221,6 +223,16 @@ namespace Faunus
                     Pid += N / V;
                 }
 
+                inline bool _combine( AnalysisBase &other ) override
+                {
+                    auto o = dynamic_cast<VirialPressure *>(&other);
+                    if ( o == nullptr )
+                        return false;
+                    Texcess += o->Texcess;
+                    Pid = Pid + o->Pid;
+                    return true;
+                }
+
             public:
                 template<class Tpotential>
                     VirialPressure( Tmjson &j, Tpotential &pot, Tspace &spc ) : spc(&spc), pot(&pot), AnalysisBase(j)
@@ -2053,6 +2065,7 @@ namespace Faunus
                 virtual void update(data &d)=0;   // called on each defined data set
                 void _sample() override;
                 Tmjson _json() override;
+                bool _combine(AnalysisBase &) override;
 
             public:
                 PairFunctionBase(Tmjson, string);
@@ -2848,6 +2861,12 @@ namespace Faunus
 
                 void sample(); //!< Sample all enclosed analysis
 
+                /**
+                 * @brief Add samples from another instance constructed from the same input
+                 * @note Analyses that do not implement `_combine()` keep only their own samples
+                 */
+                void combine( CombinedAnalysis & );
+
                 void test( UnitTest & );
                 string info();
                 Tmjson json();
@@ -2855,6 +2874,123 @@ namespace Faunus
                 ~CombinedAnalysis();
         };
 
+        /** @brief Energy for a re-analysis thread, constructed from JSON (e.g. `Energy::Hamiltonian`) */
+        template<class Tenergy, class Tspace>
+            Tenergy *reanalysisEnergy( Tmjson &j, Tenergy &, Tspace &spc,
+                    typename std::enable_if<std::is_constructible<Tenergy, Tmjson &, Tspace &>::value>::type * = 0 )
+            {
+                return new Tenergy(j, spc);
+            }
+
+        /** @brief Energy for a re-analysis thread, copied from `pot` */
+        template<class Tenergy, class Tspace>
+            Tenergy *reanalysisEnergy( Tmjson &, Tenergy &pot, Tspace &,
+                    typename std::enable_if<!std::is_constructible<Tenergy, Tmjson &, Tspace &>::value>::type * = 0 )
+            {
+                return new Tenergy(pot);
+            }
+
+        /**
+         * @brief Parallel re-analysis of a trajectory
+         *
+         * Frames from an xtc trajectory are loaded into Space and passed
+         * to `analysis`. The frame index of the trajectory is built (see
+         * `FormatXTC::buildindex()`) and frames are split into contiguous blocks,
+         * one for each thread. Each thread has its own file handle, Space,
+         * Hamiltonian and `CombinedAnalysis` (constructed from `j`) and the
+         * samples are finally combined into `analysis`.
+         * The following keywords are read from the JSON section `reanalysis`:
+         *
+         * Keyword      | Description
+         * :----------- | :---------------------------------------------------
+         * `file`       | Trajectory file (.xtc)
+         * `threads`    | Number of threads (default: 1)
+         * `trump`      | Enforce (PBC) boundary control on loaded frames (default: false)
+         * `indexcache` | Save/reuse the frame index in `<file>.idx` (default: false)
+         *
+         * @returns Number of frames analysed
+         *
+         * @warning Hamiltonians that can be constructed from `(j, space)`, such as
+         * `Energy::Hamiltonian`, are re-created for each thread; all other
+         * `Tenergy` are copied and must not share state between copies -- this is
+         * true for potentials combined with `operator+`.
+         * Analyses that write files during sampling (`xtcfile`)
+         * or that use the global random number generator (`widom` etc.) should
+         * only be used with a single thread.
+         */
+        template<class Tspace, class Tenergy>
+            size_t reanalyse( Tmjson &j, Tenergy &pot, Tspace &spc, CombinedAnalysis &analysis )
+            {
+                auto &m = j.at("reanalysis");
+                string file = m.at("file");
+                bool applypbc = m.value("trump", false);
+                size_t nthreads = m.value("threads", 1);
+
+                FormatXTC xtc(1);
+                if ( !xtc.open(file))
+                    throw std::runtime_error("reanalysis: xtc file " + file + " cannot be loaded");
+                size_t nframes = xtc.buildindex( m.value("indexcache", false) );
+                nthreads = std::max(size_t(1), std::min(nthreads, nframes));
+
+                // thread 0 works directly on the given objects; others on their own instances
+                std::vector<std::unique_ptr<Tspace>> spaces;
+                std::vector<std::unique_ptr<Tenergy>> pots;
+                std::vector<std::unique_ptr<CombinedAnalysis>> analyses;
+                for ( size_t t = 1; t < nthreads; t++ )
+                {
+                    spaces.emplace_back(new Tspace(spc));
+                    pots.emplace_back(reanalysisEnergy(j, pot, *spaces.back()));
+                    pots.back()->setSpace(*spaces.back());
+                    analyses.emplace_back(new CombinedAnalysis(j, *pots.back(), *spaces.back()));
+                }
+
+                std::vector<std::exception_ptr> errors(nthreads);
+                auto worker = [&]( size_t t, size_t first, size_t last, Tspace &s, Tenergy &e, CombinedAnalysis &a )
+                {
+                    try
+                    {
+                        FormatXTC x(1);
+                        if ( !x.open(file))
+                            throw std::runtime_error("reanalysis: xtc file " + file + " cannot be loaded");
+                        x.setindex(xtc.getindex());
+                        for ( size_t n = first; n < last; n++ )
+                            if ( x.loadframe(n, s, true, applypbc))
+                            {
+                                for ( auto g : s.groupList())
+                                    g->setMassCenter(s);
+                                e.setSpace(s); // box may change between frames
+                                a.sample();
+                            }
+                    }
+                    catch ( ... )
+                    {
+                        errors[t] = std::current_exception();
+                    }
+                };
+
+                std::vector<std::thread> threads;
+                size_t block = nframes / nthreads, rest = nframes % nthreads, first = 0;
+                for ( size_t t = 0; t < nthreads; t++ )
+                {
+                    size_t last = first + block + (t < rest ? 1 : 0);
+                    if ( t == 0 )
+                        threads.emplace_back(worker, t, first, last, std::ref(spc), std::ref(pot), std::ref(analysis));
+                    else
+                        threads.emplace_back(worker, t, first, last,
+                                             std::ref(*spaces[t - 1]), std::ref(*pots[t - 1]), std::ref(*analyses[t - 1]));
+                    first = last;
+                }
+                for ( auto &t : threads )
+                    t.join();
+                for ( auto &e : errors )
+                    if ( e )
+                        std::rethrow_exception(e);
+
+                for ( auto &a : analyses )
+                    analysis.combine(*a);
+                return nframes;
+            }
+
     }//namespace
 }//namespace
 #endif
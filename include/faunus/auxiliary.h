@@ -1761,6 +1761,40 @@ namespace Faunus
           void operator()( E &t, typename std::enable_if<!std::is_same<T, E>::value>::type * = 0 ) {}
       };
 
+      template<class T>
+      struct findbase
+      {
+          T *ptr;
+
+          findbase() : ptr(nullptr) {}
+
+          template<class E>
+          void operator()( E *t, typename std::enable_if<std::is_base_of<T, E>::value>::type * = 0 )
+          {
+              if ( ptr == nullptr )
+                  ptr = t;
+          }
+
+          template<class E>
+          void operator()( E &t, typename std::enable_if<!std::is_base_of<T,
+              typename std::remove_pointer<E>::type>::value>::type * = 0 ) {}
+      };
+
+      template<class T>
+      struct countbase
+      {
+          size_t cnt;
+
+          countbase() : cnt(0) {}
+
+          template<class E>
+          void operator()( E *t, typename std::enable_if<std::is_base_of<T, E>::value>::type * = 0 ) { cnt++; }
+
+          template<class E>
+          void operator()( E &t, typename std::enable_if<!std::is_base_of<T,
+              typename std::remove_pointer<E>::type>::value>::type * = 0 ) {}
+      };
+
       template<class Tuple, std::size_t N>
       struct TuplePrinter
       {
@@ -1793,6 +1827,24 @@ namespace Faunus
           for_each(t, func);  // ... on all elements
           return func.ptr;
       }
+
+      /** @brief First pointer in tuple of pointers that points to a class derived from `T`. `nullptr` if not found. */
+      template<class T, class... Args>
+      static T *getBase( std::tuple<Args...> &t )
+      {
+          findbase<T> func;
+          for_each(t, func);
+          return func.ptr;
+      }
+
+      /** @brief Number of pointers in tuple of pointers that point to a class derived from `T` */
+      template<class T, class... Args>
+      static size_t countBase( std::tuple<Args...> &t )
+      {
+          countbase<T> func;
+          for_each(t, func);
+          return func.cnt;
+      }
   };
 
   /**
@@ -1828,6 +1880,9 @@ namespace Faunus
           auto total = std::chrono::duration_cast<Tunit>(now - t0);
           return delta.count() / double(total.count());
       }
+
+      /** @brief Time consumed in between start/stop calls (seconds) */
+      double seconds() const { return std::chrono::duration<double>(delta).count(); }
   };
 
 }//namespace
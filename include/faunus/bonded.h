@@ -48,7 +48,8 @@ namespace Faunus
      *
      * where the first filed specifies the two particle index; `k` (kT) and `req` (angstrom)
      * are the force constant and equilibrium distance, respectively. By default, the bond
-     * type is set to `HARMONIC`.
+     * type is set to `HARMONIC`. For `"type":"fene"`, `k` is the stiffness (kT) and `req` the
+     * maximum separation (angstrom), see `Potential::FENE`.
      */
     struct BondData : public BondedBase
     {
@@ -75,6 +76,10 @@ namespace Faunus
             string t = it.value()["type"] | string("harmonic");
             if ( t == "harmonic" )
                 type = Type::HARMONIC;
+            else if ( t == "fene" )
+                type = Type::FENE;
+            else
+                throw std::runtime_error("Unknown bond type: " + t);
         }
 
         /** @brief Write to stream */
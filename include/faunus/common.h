@@ -18,6 +18,7 @@
 #include <cassert>
 #include <complex>
 #include <map>
+#include <unordered_map>
 #include <random>
 #include <set>
 #include <memory>
@@ -14,6 +14,7 @@
 #include <faunus/auxiliary.h>
 #include <faunus/bonded.h>
 #include <faunus/multipole.h>
+#include <faunus/profiler.h>
 #include <Eigen/Eigenvalues>
 
 #endif
@@ -39,6 +40,28 @@ namespace Faunus
   namespace Energy
   {
 
+    /**
+     * @brief Particles in `index` that belong to `g`, each listed once
+     *
+     * `moved` is resized to the group size and flags the returned particles
+     * by their position relative to `g.front()`. Used by `g_internal_subset()`
+     * implementations so that duplicate indices are not counted twice.
+     */
+    inline std::vector<int> uniqueSubset( Group &g, const std::vector<int> &index, std::vector<char> &moved )
+    {
+        std::vector<int> v;
+        v.reserve(index.size());
+        moved.assign(g.size(), 0);
+        for ( auto i : index )
+            if ( g.find(i))
+                if ( !moved[i - g.front()] )
+                {
+                    moved[i - g.front()] = 1;
+                    v.push_back(i);
+                }
+        return v;
+    }
+
 /**
      *  @brief Base class for energy evaluation
      *
@@ -151,6 +174,19 @@ namespace Faunus
         virtual double g_internal( const Tpvec &, Group & )      // Internal energy of group
         { return 0; }
 
+        /**
+         * @brief Internal energy of group terms that involve the particles in `index`
+         *
+         * Used for local moves where only a subset of a molecule is displaced.
+         * The returned value may differ from `g_internal()` by terms that are
+         * independent of the particles in `index`, i.e. only *differences*
+         * between two configurations with the same `index` are meaningful.
+         * Duplicate indices are ignored, see `uniqueSubset()`.
+         * The default implementation returns the full `g_internal()`.
+         */
+        virtual double g_internal_subset( const Tpvec &p, Group &g, const std::vector<int> &index )
+        { return g_internal(p, g); }
+
         virtual double v2v( const Tpvec &, const Tpvec & )       // Particle vector-Particle vector energy
         { return 0; }
 
@@ -166,6 +202,18 @@ namespace Faunus
         virtual void field( const Tpvec &, Eigen::MatrixXd & ) //!< Calculate electric field on all particles
         {}
 
+        /**
+         * @brief Add field contributions that involve the particles in `index`
+         *
+         * That is the field from particles in `index` on all particles and the
+         * field on particles in `index` from all sources. If two configurations
+         * differ only in `index`, the field of one follows from the other by
+         * subtracting this for the old and adding it for the new configuration.
+         * The default implementation adds the full `field()`.
+         */
+        virtual void field( const Tpvec &p, Eigen::MatrixXd &E, const std::vector<int> &index )
+        { field(p, E); }
+
         virtual double systemEnergy( const Tpvec &p )
         {
             double u_pair = 0.0;
@@ -688,53 +736,97 @@ namespace Faunus
             return first.f_p2p(a, b) + second.f_p2p(a, b);
         }
 
-        double all2p( const Tpvec &p, const Tparticle &a ) override { return first.all2p(p, a) + second.all2p(p, a); }
+        double all2p( const Tpvec &p, const Tparticle &a ) override
+        {
+            return FAU_PROFILE_CALL(first, all2p, p, a) + FAU_PROFILE_CALL(second, all2p, p, a);
+        }
 
-        double i2i( const Tpvec &p, int i, int j ) override { return first.i2i(p, i, j) + second.i2i(p, i, j); }
+        double i2i( const Tpvec &p, int i, int j ) override
+        {
+            return FAU_PROFILE_CALL(first, i2i, p, i, j) + FAU_PROFILE_CALL(second, i2i, p, i, j);
+        }
 
-        double i2g( const Tpvec &p, Group &g, int i ) override { return first.i2g(p, g, i) + second.i2g(p, g, i); }
+        double i2g( const Tpvec &p, Group &g, int i ) override
+        {
+            return FAU_PROFILE_CALL(first, i2g, p, g, i) + FAU_PROFILE_CALL(second, i2g, p, g, i);
+        }
 
-        double i2all( Tpvec &p, int i ) override { return first.i2all(p, i) + second.i2all(p, i); }
+        double i2all( Tpvec &p, int i ) override
+        {
+            return FAU_PROFILE_CALL(first, i2all, p, i) + FAU_PROFILE_CALL(second, i2all, p, i);
+        }
+
+        double i_external( const Tpvec &p, int i ) override
+        {
+            return FAU_PROFILE_CALL(first, i_external, p, i) + FAU_PROFILE_CALL(second, i_external, p, i);
+        }
 
-        double i_external( const Tpvec &p, int i ) override { return first.i_external(p, i) + second.i_external(p, i); }
+        double i_internal( const Tpvec &p, int i ) override
+        {
+            return FAU_PROFILE_CALL(first, i_internal, p, i) + FAU_PROFILE_CALL(second, i_internal, p, i);
+        }
 
-        double i_internal( const Tpvec &p, int i ) override { return first.i_internal(p, i) + second.i_internal(p, i); }
+        double p_external( const Tparticle &a ) override
+        {
+            return FAU_PROFILE_CALL(first, p_external, a) + FAU_PROFILE_CALL(second, p_external, a);
+        }
 
         double g2g( const Tpvec &p, Group &g1, Group &g2 ) override
         {
-            return first.g2g(p, g1, g2) + second.g2g(p, g1, g2);
+            return FAU_PROFILE_CALL(first, g2g, p, g1, g2) + FAU_PROFILE_CALL(second, g2g, p, g1, g2);
         }
 
         double g1g2( const Tpvec &p1, Group &g1, const Tpvec &p2, Group &g2 ) override
         {
-            return first.g1g2(p1, g1, p2, g2) + second.g1g2(p1, g1, p2, g2);
+            return FAU_PROFILE_CALL(first, g1g2, p1, g1, p2, g2) + FAU_PROFILE_CALL(second, g1g2, p1, g1, p2, g2);
         }
 
         double g_external( const Tpvec &p, Group &g ) override
         {
-            return first.g_external(p, g) + second.g_external(p, g);
+            return FAU_PROFILE_CALL(first, g_external, p, g) + FAU_PROFILE_CALL(second, g_external, p, g);
         }
 
         double g_internal( const Tpvec &p, Group &g ) override
         {
-            return first.g_internal(p, g) + second.g_internal(p, g);
+            return FAU_PROFILE_CALL(first, g_internal, p, g) + FAU_PROFILE_CALL(second, g_internal, p, g);
+        }
+
+        double g_internal_subset( const Tpvec &p, Group &g, const std::vector<int> &index ) override
+        {
+            return FAU_PROFILE_CALL(first, g_internal_subset, p, g, index)
+                + FAU_PROFILE_CALL(second, g_internal_subset, p, g, index);
         }
 
-        double external( const Tpvec &p ) override { return first.external(p) + second.external(p); }
+        double external( const Tpvec &p ) override
+        {
+            return FAU_PROFILE_CALL(first, external, p) + FAU_PROFILE_CALL(second, external, p);
+        }
 
-        double update( bool b ) override { return first.update(b) + second.update(b); }
+        double update( bool b ) override
+        {
+            return FAU_PROFILE_CALL(first, update, b) + FAU_PROFILE_CALL(second, update, b);
+        }
 
         double updateChange( const typename Tspace::Change &c ) override
         {
-            return first.updateChange(c) + second.updateChange(c);
+            return FAU_PROFILE_CALL(first, updateChange, c) + FAU_PROFILE_CALL(second, updateChange, c);
         }
 
-        double v2v( const Tpvec &p1, const Tpvec &p2 ) override { return first.v2v(p1, p2) + second.v2v(p1, p2); }
+        double v2v( const Tpvec &p1, const Tpvec &p2 ) override
+        {
+            return FAU_PROFILE_CALL(first, v2v, p1, p2) + FAU_PROFILE_CALL(second, v2v, p1, p2);
+        }
 
         void field( const Tpvec &p, Eigen::MatrixXd &E ) override
         {
-            first.field(p, E);
-            second.field(p, E);
+            FAU_PROFILE_CALL(first, field, p, E);
+            FAU_PROFILE_CALL(second, field, p, E);
+        }
+
+        void field( const Tpvec &p, Eigen::MatrixXd &E, const std::vector<int> &index ) override
+        {
+            FAU_PROFILE_CALL(first, field, p, E, index);
+            FAU_PROFILE_CALL(second, field, p, E, index);
         }
     };
 
@@ -833,6 +925,7 @@ namespace Faunus
 
         double all2p( const Tpvec &p, const Tparticle &a ) override
         {
+            FAU_PROFILE_PAIRS(p.size());
             double u = 0;
             for ( auto &b : p )
                 u += pairpot(a, b, geo.sqdist(a, b));
@@ -841,6 +934,7 @@ namespace Faunus
 
         double i2i( const Tpvec &p, int i, int j ) override
         {
+            FAU_PROFILE_PAIRS(1);
             return pairpot(p[i], p[j], geo.sqdist(p[i], p[j]));
         }
 
@@ -850,6 +944,7 @@ namespace Faunus
             if ( !g.empty())
             {
                 int len = g.back() + 1;
+                FAU_PROFILE_PAIRS(g.find(j) ? g.size() - 1 : g.size());
                 if ( g.find(j))
                 {   //j is inside g - avoid self interaction
                     for ( int i = g.front(); i < j; i++ )
@@ -869,6 +964,7 @@ namespace Faunus
             assert(i >= 0 && i < int(p.size()) && "index i outside particle vector");
             double u = 0;
             int n = (int) p.size();
+            FAU_PROFILE_PAIRS(n - 1);
             for ( int j = 0; j != i; ++j )
                 u += pairpot(p[i], p[j], geo.sqdist(p[i], p[j]));
             for ( int j = i + 1; j < n; ++j )
@@ -887,6 +983,7 @@ namespace Faunus
                         if ( g1.find(g2.back()))
                         {  // g2 is a subgroup of g1
                             assert(g1.size() >= g2.size());
+                            FAU_PROFILE_PAIRS((g1.size() - g2.size()) * g2.size());
                             for ( int i = g1.front(); i < g2.front(); i++ )
                                 for ( auto j : g2 )
                                     u += pairpot(p[i], p[j], geo.sqdist(p[i], p[j]));
@@ -899,6 +996,7 @@ namespace Faunus
                         if ( g2.find(g1.back()))
                         {  // g1 is a subgroup of g2
                             assert(g2.size() >= g1.size());
+                            FAU_PROFILE_PAIRS((g2.size() - g1.size()) * g1.size());
                             for ( int i = g2.front(); i < g1.front(); i++ )
                                 for ( auto j : g1 )
                                     u += pairpot(p[i], p[j], geo.sqdist(p[i], p[j]));
@@ -910,6 +1008,7 @@ namespace Faunus
 
                     // IN CASE BOTH GROUPS ARE INDEPENDENT (DEFAULT)
                     int ilen = g1.back() + 1, jlen = g2.back() + 1;
+                    FAU_PROFILE_PAIRS(g1.size() * g2.size());
 #pragma omp parallel for reduction (+:u)
                     for ( int i = g1.front(); i < ilen; ++i )
                         for ( int j = g2.front(); j < jlen; ++j )
@@ -920,6 +1019,7 @@ namespace Faunus
 
         double g1g2( const Tpvec &p1, Group &g1, const Tpvec &p2, Group &g2 ) override
         {
+            FAU_PROFILE_PAIRS(g1.size() * g2.size());
             double u = 0;
             for ( auto i : g1 )
                 for ( auto j : g2 )
@@ -932,6 +1032,7 @@ namespace Faunus
             assert(g.size() <= (int) p.size());
             double u = 0;
             int b = g.back(), f = g.front();
+            FAU_PROFILE_PAIRS(g.size() * (g.size() - 1) / 2);
             if ( !g.empty())
                 for ( int i = f; i < b; ++i )
                     for ( int j = i + 1; j <= b; ++j )
@@ -940,8 +1041,35 @@ namespace Faunus
             return u;
         }
 
+        /**
+         * @brief Pairs within `g` involving at least one particle in `index`
+         *
+         * Moved-static pairs plus moved-moved pairs (counted once), i.e.
+         * \f$\mathcal{O}(mN)\f$ instead of \f$\mathcal{O}(N^2)\f$ for `m` moved particles.
+         */
+        double g_internal_subset( const Tpvec &p, Group &g, const std::vector<int> &index ) override
+        {
+            double u = 0;
+            if ( !g.empty())
+            {
+                int b = g.back(), f = g.front();
+                std::vector<char> moved;
+                for ( auto i : uniqueSubset(g, index, moved))
+                {
+                    FAU_PROFILE_PAIRS(g.size() - 1);
+                    for ( int j = f; j <= b; ++j )
+                        if ( !moved[j - f] || j > i )
+                            if ( j != i )
+                                u += pairpot(p[i], p[j], geo.sqdist(p[i], p[j]));
+                }
+            }
+            u += pairpot.internal(p, g);
+            return u;
+        }
+
         double v2v( const Tpvec &p1, const Tpvec &p2 ) override
         {
+            FAU_PROFILE_PAIRS(p1.size() * p2.size());
             double u = 0;
             for ( auto &i : p1 )
                 for ( auto &j : p2 )
@@ -950,6 +1078,237 @@ namespace Faunus
         }
     };
 
+    /**
+     * @brief Interface for energy terms with an analytic energy change upon isotropic scaling
+     *
+     * Used by `Move::Isobaric` to avoid a full energy evaluation in each
+     * volume move.
+     */
+    class IsotropicScaling
+    {
+    public:
+        virtual ~IsotropicScaling() {}
+
+        /**
+         * @brief Energy change (kT) if the box lengths are isotropically scaled by `s`
+         *
+         * Atomic groups are assumed scaled by `s` while particles of other
+         * groups are taken from `Space::trial` and `Space::geo_trial`.
+         *
+         * @returns NaN if the energy change cannot be obtained analytically
+         */
+        virtual double scalingEnergyChange( double s )=0;
+
+        /** @brief Discard cached data, forcing a full recalculation */
+        virtual void invalidate()=0;
+    };
+
+    /**
+     * @brief Non-bonded interactions with an inverse power decomposition for O(1) volume moves
+     *
+     * For pair potentials that are pure sums of inverse powers of the distance,
+     * i.e. `LennardJones`, `R12Repulsion`, `Coulomb` and combinations thereof
+     * (see `Potential::InversePowerLaw`), the total non-bonded energy is
+     * \f$ U = \sum_n U_n \f$ where \f$ U_n \f$ is the sum of all \f$ r^{-n} \f$
+     * contributions. When all distances are scaled by `s`, the new energy is
+     * \f$ \sum_n s^{-n} U_n \f$ which is used by `Move::Isobaric` to evaluate
+     * volume moves without looping over particle pairs.
+     *
+     * The partial sums are updated incrementally when moves registered in
+     * `Space::Change` are accepted. Accepted moves that do not register their
+     * change, as well as insertions and deletions, cause a full recalculation
+     * at the next volume move. The analytic expression covers only pairs
+     * of particles in atomic groups which scale uniformly with the box. Molecular
+     * groups are rigid and only their mass centers are scaled, so pairs involving
+     * them are evaluated explicitly from the trial configuration; intra-molecular
+     * pairs are unaffected by the scaling and skipped. The cost of a volume move
+     * is therefore proportional to the number of particles in molecular groups
+     * times the total number of particles. Energies are otherwise identical to
+     * `Nonbonded`.
+     */
+    template<class Tspace, class Tpairpot>
+    class NonbondedScaling : public Nonbonded<Tspace, Tpairpot>, public IsotropicScaling
+    {
+    private:
+        static_assert(Potential::InversePowerLaw<Tpairpot>::value,
+                      "Tpairpot must be a sum of inverse powers, see Potential::InversePowerLaw");
+
+        typedef Nonbonded<Tspace, Tpairpot> base;
+        typedef typename base::Tparticle Tparticle;
+        typedef Potential::InversePowers Tpowers;
+        using base::spc;
+        using base::geo;
+        using base::pairpot;
+
+        Tpowers usum;                              // U_n for current configuration
+        bool dirty;                                // true if usum must be recalculated
+        bool unknown;                              // pending change cannot be tracked
+        double scale;                              // pending scaling factor
+        std::vector<std::pair<int, Tparticle>> old;// pending change: moved particles before move
+        std::vector<char> moved;                   // flag for moved particles
+        std::vector<int> rigid;                    // molecule index of each particle; -1 if in atomic group
+
+        void add( const Tparticle &a, const Tparticle &b, Tpowers &u ) const
+        {
+            Potential::InversePowerLaw<Tpairpot>::add(pairpot, a, b, geo.sqdist(a, b), u);
+        }
+
+        /** @brief Assign molecule index to particles that do not scale uniformly */
+        void setRigid()
+        {
+            int n = 0;
+            rigid.assign(spc->p.size(), -2);
+            for ( auto g : spc->groupList())
+                if ( g->isAtomic())
+                    for ( auto i : *g )
+                        rigid[i] = -1;
+                else
+                    for ( int m = 0; m < g->numMolecules(); m++ )
+                    {
+                        Group sel;
+                        g->getMolecule(m, sel);
+                        for ( auto i : sel )
+                            rigid[i] = n;
+                        n++;
+                    }
+            for ( auto &i : rigid ) // particles outside groups are never moved
+                if ( i == -2 )
+                    i = n++;
+        }
+
+        /** @brief Full O(N^2) calculation of partial sums */
+        void recalculate()
+        {
+            auto &p = spc->p;
+            setRigid();
+            usum.fill(0);
+            for ( size_t i = 0; i < p.size(); i++ )
+                if ( rigid[i] < 0 )
+                    for ( size_t j = i + 1; j < p.size(); j++ )
+                        if ( rigid[j] < 0 )
+                            add(p[i], p[j], usum);
+            dirty = false;
+        }
+
+        /** @brief Energy change of all inter-molecular pairs that involve molecular groups */
+        double rigidChange()
+        {
+            auto &p = spc->p;
+            auto &t = spc->trial;
+            double du = 0;
+            for ( size_t i = 0; i < p.size(); i++ )
+                if ( rigid[i] >= 0 )
+                    for ( size_t j = 0; j < p.size(); j++ )
+                        if ( rigid[j] < 0 || (j > i && rigid[j] != rigid[i]))
+                            du += pairpot(t[i], t[j], spc->geo_trial.sqdist(t[i], t[j]))
+                                - pairpot(p[i], p[j], spc->geo.sqdist(p[i], p[j]));
+            return du;
+        }
+
+        /** @brief Update partial sums with accepted particle displacements */
+        void updateMoved()
+        {
+            auto &p = spc->p;
+            Tpowers unew, uold;
+            unew.fill(0);
+            uold.fill(0);
+            moved.assign(p.size(), 0);
+            for ( auto &m : old )
+                moved[m.first] = 1;
+            for ( size_t k = 0; k < old.size(); k++ )
+            {
+                int i = old[k].first;
+                if ( rigid[i] >= 0 ) // not part of the partial sums
+                    continue;
+                for ( size_t j = 0; j < p.size(); j++ ) // moved <-> static
+                    if ( !moved[j] && rigid[j] < 0 )
+                    {
+                        add(p[i], p[j], unew);
+                        add(old[k].second, p[j], uold);
+                    }
+                for ( size_t l = k + 1; l < old.size(); l++ ) // moved <-> moved
+                    if ( rigid[old[l].first] < 0 )
+                    {
+                        add(p[i], p[old[l].first], unew);
+                        add(old[k].second, old[l].second, uold);
+                    }
+            }
+            for ( size_t n = 0; n < usum.size(); n++ )
+                usum[n] += unew[n] - uold[n];
+        }
+
+    public:
+        NonbondedScaling( Tmjson &j, const string &sec = "nonbonded" ) : base(j, sec), dirty(true), unknown(false), scale(1)
+        {
+            base::name += " (volume scaling)";
+        }
+
+        auto tuple() -> decltype(std::make_tuple(this))
+        {
+            return std::make_tuple(this);
+        }
+
+        double updateChange( const typename Tspace::Change &c ) override
+        {
+            old.clear();
+            scale = 1;
+            unknown = false;
+            if ( c.empty() || !c.rmGroup.empty() || !c.inGroup.empty())
+                unknown = true;
+            else if ( c.geometryChange )
+            {
+                Point r = spc->geo_trial.len.cwiseQuotient(spc->geo.len);
+                if ( std::fabs(r.x() - r.y()) > 1e-12 || std::fabs(r.x() - r.z()) > 1e-12 )
+                    unknown = true;
+                else
+                    scale = r.x();
+            }
+            else
+                for ( auto &m : c.mvGroup )
+                {
+                    auto g = spc->groupList()[m.first];
+                    if ( m.second.empty()) // all particles in group have moved
+                        for ( auto i : *g )
+                            old.push_back({i, spc->p[i]});
+                    else
+                        for ( auto i : m.second )
+                            old.push_back({i, spc->p[i]});
+                }
+            return 0;
+        }
+
+        double update( bool acc ) override
+        {
+            if ( acc && !dirty )
+            {
+                if ( unknown )
+                    dirty = true;
+                else if ( scale != 1 )
+                    for ( size_t n = 0; n < usum.size(); n++ )
+                        usum[n] *= std::pow(scale, -double(n));
+                else if ( !old.empty())
+                    updateMoved();
+            }
+            old.clear();
+            scale = 1;
+            unknown = false;
+            return 0;
+        }
+
+        void invalidate() override { dirty = true; }
+
+        double scalingEnergyChange( double s ) override
+        {
+            if ( dirty || rigid.size() != spc->p.size())
+                recalculate();
+            double du = rigidChange();
+            for ( size_t n = 1; n < usum.size(); n++ )
+                if ( usum[n] != 0 )
+                    du += usum[n] * (std::pow(s, -double(n)) - 1);
+            return du;
+        }
+    };
+
 /**
      * @brief Energy class for non-bonded interactions that excludes bonded pairs.
      *
@@ -1047,6 +1406,22 @@ namespace Faunus
                         u += pairpot(p[i], p[j], geo.sqdist(p[i], p[j])) * excl(i, j);
             return u;
         }
+
+        double g_internal_subset( const Tpvec &p, Group &g, const std::vector<int> &index ) override
+        {
+            double u = 0;
+            if ( !g.empty())
+            {
+                int b = g.back(), f = g.front();
+                std::vector<char> moved;
+                for ( auto i : uniqueSubset(g, index, moved))
+                    for ( int j = f; j <= b; ++j )
+                        if ( !moved[j - f] || j > i )
+                            if ( j != i )
+                                u += pairpot(p[i], p[j], geo.sqdist(p[i], p[j])) * excl(i, j);
+            }
+            return u;
+        }
     };
 
 /**
@@ -1071,6 +1446,29 @@ namespace Faunus
         typedef typename Tbase::Tpvec Tpvec;
         bool groupBasedField;
 
+        /**
+         * @brief Energy of `p[i]` with particles in `[first,last)`, skipping `i`
+         *
+         * If the pair potential has a `batch()` function with the same
+         * signature, e.g. `Potential::CigarSphereSplit`, this is used instead.
+         */
+        template<class T=Tpairpot>
+        auto i2range( const Tpvec &p, int i, int first, int last, int )
+        -> decltype(std::declval<T &>().batch(std::declval<typename Tspace::GeometryType &>(), p, i, first, last))
+        {
+            return pairpot.batch(geo, p, i, first, last);
+        }
+
+        double i2range( const Tpvec &p, int i, int first, int last, long )
+        {
+            double u = 0;
+#pragma omp parallel for reduction (+:u) if (last-first>1000)
+            for ( int j = first; j < last; j++ )
+                if ( j != i )
+                    u += pairpot(p[i], p[j], geo.vdist(p[i], p[j]));
+            return u;
+        }
+
     public:
         typename Tspace::GeometryType geo;
         Tpairpot pairpot;
@@ -1088,6 +1486,7 @@ namespace Faunus
         void setSpace( Tspace &s ) override
         {
             geo = s.geo;
+            pairpot.setSpace(s);
             Tbase::setSpace(s);
         }
 
@@ -1123,34 +1522,15 @@ namespace Faunus
 
         double i2g( const Tpvec &p, Group &g, int j ) override
         {
-            double u = 0;
-            if ( !g.empty())
-            {
-                int len = g.back() + 1;
-                if ( g.find(j))
-                {   //j is inside g - avoid self interaction
-                    for ( int i = g.front(); i < j; i++ )
-                        u += pairpot(p[i], p[j], geo.vdist(p[i], p[j]));
-                    for ( int i = j + 1; i < len; i++ )
-                        u += pairpot(p[i], p[j], geo.vdist(p[i], p[j]));
-                }
-                else              //simple - j not in g
-                    for ( int i = g.front(); i < len; i++ )
-                        u += pairpot(p[i], p[j], geo.vdist(p[i], p[j]));
-            }
-            return u;
+            if ( g.empty())
+                return 0;
+            return i2range(p, j, g.front(), g.back() + 1, 0); // j may be inside g
         }
 
         double i2all( Tpvec &p, int i ) override
         {
             assert(i >= 0 && i < int(p.size()) && "index i outside particle vector");
-            std::swap(p[0], p[i]);
-            double u = 0;
-#pragma omp parallel for reduction (+:u)
-            for ( int j = 1; j < (int) p.size(); ++j )
-                u += pairpot(p[0], p[j], geo.vdist(p[0], p[j]));
-            std::swap(p[0], p[i]);
-            return u;
+            return i2range(p, i, 0, p.size(), 0);
         }
 
         double g2g( const Tpvec &p, Group &g1, Group &g2 ) override
@@ -1189,8 +1569,7 @@ namespace Faunus
                     int ilen = g1.back() + 1, jlen = g2.back() + 1;
 #pragma omp parallel for reduction (+:u) schedule (dynamic)
                     for ( int i = g1.front(); i < ilen; ++i )
-                        for ( int j = g2.front(); j < jlen; ++j )
-                            u += pairpot(p[i], p[j], geo.vdist(p[i], p[j]));
+                        u += i2range(p, i, g2.front(), jlen, 0);
                 }
             return u;
         }
@@ -1215,6 +1594,22 @@ namespace Faunus
             return u;
         }
 
+        double g_internal_subset( const Tpvec &p, Group &g, const std::vector<int> &index ) override
+        {
+            double u = 0;
+            if ( !g.empty())
+            {
+                const int b = g.back(), f = g.front();
+                std::vector<char> moved;
+                for ( auto i : uniqueSubset(g, index, moved))
+                    for ( int j = f; j <= b; ++j )
+                        if ( !moved[j - f] || j > i )
+                            if ( j != i )
+                                u += pairpot(p[i], p[j], geo.vdist(p[i], p[j]));
+            }
+            return u;
+        }
+
         double v2v( const Tpvec &p1, const Tpvec &p2 ) override
         {
             double u = 0;
@@ -1257,6 +1652,32 @@ namespace Faunus
                 }
             }
         }
+
+        /**
+         * Adds the field from particles in `index` on all particles and
+         * the field on particles in `index` from all other particles.
+         * Pairs within `index` are counted once.
+         */
+        void field( const Tpvec &p, Eigen::MatrixXd &E, const std::vector<int> &index ) override
+        {
+            assert((int) p.size() == E.cols());
+            const int N = (int) p.size();
+            std::vector<char> inside(N, 0);
+            for ( auto i : index )
+                inside[i] = 1;
+            for ( auto i : index )
+            {
+                Group *gi = groupBasedField ? Tbase::spc->findGroup(i) : nullptr;
+                for ( int j = 0; j < N; ++j )
+                    if ( j != i && !(inside[j] && j < i))
+                        if ( !groupBasedField || gi != Tbase::spc->findGroup(j))
+                        {
+                            Point r = geo.vdist(p[i], p[j]);
+                            E.col(i) += pairpot.field(p[j], r);
+                            E.col(j) += pairpot.field(p[i], -r);
+                        }
+            }
+        }
     };
 
 /**
@@ -1305,6 +1726,27 @@ namespace Faunus
             return u;
         }
 
+        double g_internal_subset( const typename base::Tpvec &p, Group &g, const std::vector<int> &index ) override
+        {
+            double u = 0;
+            if ( !g.empty())
+            {
+                int b = g.back(), f = g.front();
+                std::vector<char> moved;
+                for ( auto i : uniqueSubset(g, index, moved))
+                    for ( int j = f; j <= b; ++j )
+                        if ( !moved[j - f] || j > i )
+                            if ( j != i )
+                            {
+                                auto _u = base::pairpot(p[i], p[j], base::geo.sqdist(p[i], p[j]));
+                                if ( std::isinf(_u))
+                                    return INFINITY;
+                                u += _u;
+                            }
+            }
+            return u;
+        }
+
     };
 
 /**
@@ -1335,8 +1777,11 @@ namespace Faunus
 
         Point getMassCenter( const typename base::Tpvec &p, const Group &g )
         {
-            assert(&p == &base::spc->p || &p == &base::spc->trial);
-            return (&p == &base::spc->p) ? g.cm : g.cm_trial;
+            if ( &p == &base::spc->p )
+                return g.cm;
+            if ( &p == &base::spc->trial )
+                return g.cm_trial;
+            return Geometry::massCenter(base::geo, p, g); // other trial vector
         }
 
         bool cut( const Tpvec &p, const Group &g1, const Group &g2 )
@@ -1413,6 +1858,8 @@ namespace Faunus
             }
         }
 
+        using base::field;
+
         // unfinished
         void field( const typename base::Tpvec &p, Eigen::MatrixXd &E ) override
         {
@@ -1511,6 +1958,20 @@ namespace Faunus
      *     double rij2 = ... ;                 // squared distance between i and j
      *     double u = b(i,j)( p[i], p[j], rij2 ); // i j bond energy in kT
      *
+     * Bonds are compiled into a topology used by all energy functions:
+     *
+     * - a contiguous array of bonds sorted by the lower particle index so that
+     *   the bonds of a group form a single segment found by binary search,
+     * - a per-particle adjacency in compressed sparse row (CSR) format used by `i2all()`,
+     * - harmonic and FENE bonds store their parameters and are evaluated inline;
+     *   any other pair potential is called through the stored functor.
+     *
+     * The intramolecular energy thus scales linearly with the number of bonds.
+     * The topology is rebuilt lazily after bonds are added or cleared. Since this
+     * is not thread safe, the first energy evaluation after `add()` must be made
+     * outside parallel regions, which is always the case when the system
+     * energy is calculated before moves are made.
+     *
      * @date Lund, 2011-2012
      */
     template<class Tspace>
@@ -1529,8 +1990,63 @@ namespace Faunus
         typedef std::function<
             Point( const Tparticle &, const Tparticle &, double, const Point & )> Tforce;
 
+        typedef typename Tbase::Tpair Tpair;
+
+        /** @brief Compiled bond with inline parameters */
+        struct Bond
+        {
+            enum class Type : char { HARMONIC, FENE, GENERIC };
+            int i, j;        // particle index, i<j
+            Type type;
+            double k;        // harmonic: force constant; FENE: stiffness
+            double r;        // harmonic: equilibrium distance; FENE: squared max. separation
+            double rinv;     // FENE: inverse squared max. separation
+            const std::function<double( const Tparticle &, const Tparticle &, double )> *u = nullptr;
+            const Tforce *f = nullptr;
+
+            inline double energy( const Tparticle &a, const Tparticle &b, double r2 ) const
+            {
+                switch ( type )
+                {
+                    case Type::HARMONIC:
+                    {
+                        double d = std::sqrt(r2) - r;
+                        return k * d * d;
+                    }
+                    case Type::FENE:
+                        return (r2 > r) ? pc::infty : -0.5 * k * r * std::log(1 - r2 * rinv);
+                    default:
+                        return (*u)(a, b, r2);
+                }
+            }
+
+            /** @brief Force on `a`; `d` is the distance vector a-b */
+            inline Point force( const Tparticle &a, const Tparticle &b, double r2, const Point &d ) const
+            {
+                switch ( type )
+                {
+                    case Type::HARMONIC:
+                    {
+                        double l = std::sqrt(r2);
+                        return -2 * k * (l - r) / l * d;
+                    }
+                    case Type::FENE:
+                        return (r2 > r) ? Point(-pc::infty * d) : Point(-k * r / (r - r2) * d);
+                    default:
+                        return (*f)(a, b, r2, d);
+                }
+            }
+        };
+
         using Energybase<Tspace>::spc;
-        std::map<typename Tbase::Tpair, Tforce> force_list;
+        std::map<Tpair, Tforce> force_list;
+        std::map<Tpair, Bond> bond_list;  // bond parameters as added
+        std::vector<Bond> bonds;          // compiled bonds sorted by lower index
+        std::vector<int> offset;          // CSR: bonds of particle i are adj[offset[i]:offset[i+1]]
+        std::vector<int> adj;             // CSR: index in `bonds`
+        bool compiled;                    // true if topology is up-to-date
+        bool autobonds;     // true if bonds were generated from molecule definitions
+        size_t nparticles;  // number of particles when bonds were generated
 
         string _infolist;
 
@@ -1560,10 +2076,85 @@ namespace Faunus
             }
         };
 
+        /** @brief Build sorted bond array and CSR adjacency from `bond_list` */
+        void compile()
+        {
+            bonds.clear();
+            bonds.reserve(bond_list.size());
+            int n = 0;
+            for ( auto &m : bond_list ) // map is ordered by lower, then upper index
+            {
+                Bond b = m.second;
+                if ( b.type == Bond::Type::GENERIC )
+                {
+                    b.u = &Tbase::list.at(m.first);
+                    b.f = &force_list.at(m.first);
+                }
+                bonds.push_back(b);
+                n = std::max(n, b.j + 1);
+            }
+            offset.assign(n + 1, 0);
+            for ( auto &b : bonds )
+            {
+                offset[b.i + 1]++;
+                offset[b.j + 1]++;
+            }
+            for ( int i = 0; i < n; i++ )
+                offset[i + 1] += offset[i];
+            adj.resize(offset[n]);
+            std::vector<int> fill(offset.begin(), offset.end() - 1);
+            for ( int k = 0; k < (int) bonds.size(); k++ )
+            {
+                adj[fill[bonds[k].i]++] = k;
+                adj[fill[bonds[k].j]++] = k;
+            }
+            compiled = true;
+        }
+
+        inline void topology()
+        {
+            if ( !compiled )
+                compile();
+        }
+
+        /** @brief Range of compiled bonds with lower index in [first,last] */
+        inline std::pair<int, int> segment( int first, int last ) const
+        {
+            auto lower = [](const Bond &b, int i) { return b.i < i; };
+            auto begin = std::lower_bound(bonds.begin(), bonds.end(), first, lower);
+            auto end = std::lower_bound(begin, bonds.end(), last + 1, lower);
+            return {int(begin - bonds.begin()), int(end - bonds.begin())};
+        }
+
+        /** @brief Bond partner of `i` in compiled bond `k` */
+        inline int partner( int k, int i ) const { return bonds[k].i == i ? bonds[k].j : bonds[k].i; }
+
+        inline double energy( const Tpvec &p, const Bond &b ) const
+        {
+            return b.energy(p[b.i], p[b.j], spc->geo.sqdist(p[b.i], p[b.j]));
+        }
+
+        template<class Tpairpot>
+        void addBond( int i, int j, Tpairpot pot, const Bond &b )
+        {
+            std::ostringstream o;
+            o << textio::indent(textio::SUBSUB) << std::left << setw(7) << i
+              << setw(7) << j << pot.brief() + "\n";
+            _infolist += o.str();
+            pot.name.clear();   // potentially save a little bit of memory
+            Tbase::add(i, j, pot);// create and add functor to pair list
+            force_list[Tpair(i, j)] = ForceFunctionObject<decltype(pot)>(pot);
+            Tpair ij(i, j);
+            Bond &c = bond_list[ij] = b;
+            c.i = ij.first;
+            c.j = ij.second;
+            compiled = false;
+        }
+
     public:
         bool CrossGroupBonds; //!< Set to true if bonds cross groups (slower!). Default: false
 
-        Bonded()
+        Bonded() : compiled(false), autobonds(false), nparticles(0)
         {
             this->name = "Bonded particles";
             CrossGroupBonds = false;
@@ -1578,8 +2169,14 @@ namespace Faunus
         void setSpace( Tspace &s ) override
         {
             Energybase<Tspace>::setSpace(s);
-            if ( Tbase::mlist.empty())
-                add(spc->groupList()); // search for bonds
+            if ( Tbase::mlist.empty() || (autobonds && spc->p.size() != nparticles))
+            {
+                clear();                  // molecules inserted or deleted, i.e. GC moves
+                add(spc->groupList());    // search for bonds
+                autobonds = true;
+                nparticles = spc->p.size();
+            }
+            topology();
         }
 
         auto tuple() -> decltype(std::make_tuple(this))
@@ -1587,16 +2184,15 @@ namespace Faunus
             return std::make_tuple(this);
         }
 
-        /**
-             * @brief Bond energy i with j
-             * @todo Optimize by using iterator directly as returned by find.
-             */
+        /** @brief Bond energy i with j */
         double i2i( const Tpvec &p, int i, int j ) override
         {
             assert(i != j);
-            auto f = this->list.find(opair<int>(i, j));
-            if ( f != this->list.end())
-                return f->second(p[i], p[j], spc->geo.sqdist(p[i], p[j]));
+            topology();
+            if ( i < (int) offset.size() - 1 )
+                for ( int n = offset[i]; n < offset[i + 1]; n++ )
+                    if ( partner(adj[n], i) == j )
+                        return energy(p, bonds[adj[n]]);
             return 0;
         }
 
@@ -1610,12 +2206,14 @@ namespace Faunus
             int j = spc->findIndex(b);
             assert(i >= 0 && j >= 0);
             assert(i < (int) spc->p.size() && j < (int) spc->p.size());
-            auto f = force_list.find(opair<int>(i, j));
-            if ( f != this->force_list.end())
-            {
-                auto r = spc->geo.vdist(a, b);
-                return f->second(a, b, r.squaredNorm(), r);
-            }
+            topology();
+            if ( i < (int) offset.size() - 1 )
+                for ( int n = offset[i]; n < offset[i + 1]; n++ )
+                    if ( partner(adj[n], i) == j )
+                    {
+                        auto r = spc->geo.vdist(a, b);
+                        return bonds[adj[n]].force(a, b, r.squaredNorm(), r);
+                    }
             return Point(0, 0, 0);
         }
 
@@ -1623,54 +2221,44 @@ namespace Faunus
         double i2all( Tpvec &p, int i ) override
         {
             assert(i >= 0 && i < (int) p.size()); //debug
+            topology();
             double u = 0;
-            auto eqr = this->mlist.equal_range(i);
-            for ( auto it = eqr.first; it != eqr.second; ++it )
-            {
-                int j = it->second; // partner index
-                u += this->list[opair<int>(i, j)](
-                    p[i], p[j], spc->geo.sqdist(p[i], p[j]));
-            }
+            if ( i < (int) offset.size() - 1 )
+                for ( int n = offset[i]; n < offset[i + 1]; n++ )
+                    u += energy(p, bonds[adj[n]]);
             return u;
         }
 
         double total( const Tpvec &p )
         {
+            topology();
             double u = 0;
-            for ( auto &m : Tbase::list )
+            for ( auto &b : bonds )
             {
-                int i = m.first.first;
-                int j = m.first.second;
-                assert(i >= 0 && i < (int) p.size() && j >= 0 && j < (int) p.size()); //debug
-                u += m.second(p[i], p[j], spc->geo.sqdist(p[i], p[j]));
+                assert(b.i >= 0 && b.j < (int) p.size()); //debug
+                u += energy(p, b);
             }
             return u;
         }
 
         /**
              * Group-to-group bonds are disabled by default as these are
-             * rarely used and the current implementation is rather slow
-             * for systems with *many* groups (but very general). To
-             * activate `g2g()`, set `CrossGroupBonds=true`.
+             * rarely used. To activate `g2g()`, set `CrossGroupBonds=true`.
              *
              * @warning Untested!
-             * @todo Possible optimization: swap groups so that `g1<g2`;
              */
         double g2g( const Tpvec &p, Group &g1, Group &g2 ) override
         {
             double u = 0;
             if ( CrossGroupBonds )
+            {
+                topology();
                 for ( auto i : g1 )
-                {
-                    auto eqr = this->mlist.equal_range(i);
-                    for ( auto it = eqr.first; it != eqr.second; ++it )
-                    {
-                        int j = it->second; // partner index
-                        if ( g2.find(j))
-                            u += this->list[opair<int>(i, j)](
-                                p[i], p[j], spc->geo.sqdist(p[i], p[j]));
-                    }
-                }
+                    if ( i < (int) offset.size() - 1 )
+                        for ( int n = offset[i]; n < offset[i + 1]; n++ )
+                            if ( g2.find(partner(adj[n], i)))
+                                u += energy(p, bonds[adj[n]]);
+            }
             return u;
         }
 
@@ -1685,50 +2273,79 @@ namespace Faunus
         double g_internal( const Tpvec &p, Group &g ) override
         {
             double u = 0;
-            if ( this->list.size() > pow(g.size(), 2))
-            {
-                // small group compared to bond list
-                auto end = this->list.end();
-                for ( auto i = g.front(); i < g.back(); i++ )
-                    for ( auto j = i + 1; j <= g.back(); j++ )
+            if ( g.empty())
+                return u;
+            topology();
+            auto s = segment(g.front(), g.back());
+            for ( int k = s.first; k < s.second; k++ )
+                if ( bonds[k].j <= g.back())
+                    u += energy(p, bonds[k]);
+            return u;
+        }
+
+        /**
+         * @brief Internal bonds in Group involving particles in `index`
+         *
+         * Only bonds of the given particles are visited and
+         * bonds between two particles in `index` are counted once.
+         */
+        double g_internal_subset( const Tpvec &p, Group &g, const std::vector<int> &index ) override
+        {
+            double u = 0;
+            if ( g.empty())
+                return u;
+            topology();
+            int f = g.front();
+            std::vector<char> moved;
+            for ( auto i : uniqueSubset(g, index, moved))
+                if ( i < (int) offset.size() - 1 )
+                    for ( int n = offset[i]; n < offset[i + 1]; n++ )
                     {
-                        auto it = this->list.find(opair<int>(i, j));
-                        if ( it != end )
-                            u += it->second(p[i], p[j], spc->geo.sqdist(p[i], p[j]));
-                    }
-            }
-            else
-            {
-                // big group compared to bond list
-                for ( auto &m : this->list )
-                {
-                    int i = m.first.first, j = m.first.second;
-                    if ( g.find(i))
+                        int j = partner(adj[n], i);
                         if ( g.find(j))
-                            u += m.second(p[i], p[j], spc->geo.sqdist(p[i], p[j]));
-                }
-            }
+                            if ( !moved[j - f] || j > i )
+                                u += energy(p, bonds[adj[n]]);
+                    }
             return u;
         }
 
+        /** @brief Add bond using an arbitrary pair potential */
         template<class Tpairpot>
         void add( int i, int j, Tpairpot pot )
         {
-            std::ostringstream o;
-            o << textio::indent(textio::SUBSUB) << std::left << setw(7) << i
-              << setw(7) << j << pot.brief() + "\n";
-            _infolist += o.str();
-            pot.name.clear();   // potentially save a little bit of memory
-            Tbase::add(i, j, pot);// create and add functor to pair list
-            force_list[typename Tbase::Tpair(i, j)]
-                = ForceFunctionObject<decltype(pot)>(pot);
+            Bond b;
+            b.type = Bond::Type::GENERIC;
+            addBond(i, j, pot, b);
+        }
+
+        /** @brief Add harmonic bond (evaluated inline) */
+        void add( int i, int j, Potential::Harmonic pot )
+        {
+            Bond b;
+            b.type = Bond::Type::HARMONIC;
+            b.k = pot.k;
+            b.r = pot.req;
+            addBond(i, j, pot, b);
+        }
+
+        /** @brief Add FENE bond (evaluated inline) */
+        void add( int i, int j, Potential::FENE pot )
+        {
+            Bond b;
+            b.type = Bond::Type::FENE;
+            b.k = pot.k;
+            b.r = pot.r02;
+            b.rinv = pot.r02inv;
+            addBond(i, j, pot, b);
         }
 
-        /** @brief Add harmonic bond */
+        /** @brief Add harmonic or FENE bond */
         void add( const Faunus::Bonded::BondData &hb )
         {
             if ( hb.type == Faunus::Bonded::BondData::Type::HARMONIC )
                 add(hb.index.at(0), hb.index.at(1), Potential::Harmonic(hb.k, hb.req));
+            else if ( hb.type == Faunus::Bonded::BondData::Type::FENE )
+                add(hb.index.at(0), hb.index.at(1), Potential::FENE(hb.k, hb.req));
         }
 
         /** @brief Add all bonds found in a list of groups */
@@ -1750,6 +2367,12 @@ namespace Faunus
         void clear()
         {
             _infolist.clear();
+            force_list.clear();
+            bond_list.clear();
+            bonds.clear();
+            offset.clear();
+            adj.clear();
+            compiled = false;
             Tbase::clear();
         }
 
@@ -1907,6 +2530,25 @@ namespace Faunus
         string
         _info() override { return expot.info(); }
 
+        /**
+         * Energy of particles in `[first,last)` using `Texpot::batch()`
+         * if available, otherwise particle by particle.
+         */
+        template<class T=Texpot>
+        auto range( const typename base::Tpvec &p, int first, int last, int )
+        -> decltype(std::declval<T &>().batch(p, first, last))
+        {
+            return expot.batch(p, first, last);
+        }
+
+        double range( const typename base::Tpvec &p, int first, int last, long )
+        {
+            double u = 0;
+            for ( int i = first; i < last; i++ )
+                u += p_external(p[i]);
+            return u;
+        }
+
     public:
         Texpot expot;
 
@@ -1927,10 +2569,9 @@ namespace Faunus
 
         double g_external( const typename base::Tpvec &p, Group &g ) override
         {
-            double u = 0;
-            for ( auto i : g )
-                u += p_external(p[i]);
-            return u;
+            if ( g.empty())
+                return 0;
+            return range(p, g.front(), g.back() + 1, 0);
         }
 
         /** @brief Field on all particles due to external potential */
@@ -1941,6 +2582,13 @@ namespace Faunus
                 E.col(i) += expot.field(p[i]);
         }
 
+        void field( const typename base::Tpvec &p, Eigen::MatrixXd &E, const std::vector<int> &index ) override
+        {
+            assert((int) p.size() == E.cols());
+            for ( auto i : index )
+                E.col(i) += expot.field(p[i]);
+        }
+
         auto tuple() -> decltype(std::make_tuple(this))
         {
             return std::make_tuple(this);
@@ -2101,6 +2749,9 @@ namespace Faunus
      * one group is in contact with sites on *maximum one* other group. For large macro
      * molecules this is hardly a problem; if it is, an energy drift should show.
      *
+     * Only exposed, hydrophobic sites are paired and groups whose bounding spheres
+     * around these sites are out of contact are skipped.
+     *
      * @author Kurut / Lund
      * @date Lund, 2014
      * @note Experimental
@@ -2127,6 +2778,36 @@ namespace Faunus
         bool sample_uofr;    // set to true if we should sample U_sasa(r)
         double dr;           // U(r) resolution in r
 
+        /** @brief Exposed, hydrophobic sites of a group and their bounding sphere */
+        struct Sites
+        {
+            std::vector<int> index; // site index; the first is the sphere center
+            double radius;          // bounding sphere radius
+            double rmax;            // largest site radius
+        };
+
+        Sites s1, s2;
+
+        /**
+         * @brief Find sites that may contribute to `g2g()`
+         * @returns false if there are none
+         */
+        bool candidates( const Tpvec &p, const Group &g, Sites &s ) const
+        {
+            s.index.clear();
+            s.radius = s.rmax = 0;
+            for ( auto i : g )
+                if ( p[i].hydrophobic )
+                    if ( sasa[i] > 1e-3 )
+                    {
+                        s.index.push_back(i);
+                        s.radius = std::max(s.radius, base::spc->geo.sqdist(p[i], p[s.index[0]]));
+                        s.rmax = std::max(s.rmax, p[i].radius);
+                    }
+            s.radius = std::sqrt(s.radius);
+            return !s.index.empty();
+        }
+
         /** @brief Fraction of hydrophobic area */
         double fracHydrophobic() const
         {
@@ -2218,26 +2899,30 @@ namespace Faunus
                 if ( g1.isMolecular())
                     if ( g2.isMolecular())
                     {
-                        v.resize(p.size());
-                        std::fill(v.begin(), v.end(), true);
-                        for ( auto i : g1 )
-                            for ( auto j : g2 )
-                                if ( p[i].hydrophobic )
-                                    if ( p[j].hydrophobic )
-                                        if ( sasa[i] > 1e-3 )
-                                            if ( sasa[j] > 1e-3 )
-                                                if ( v[i] || v[j] )
-                                                {
-                                                    double r2 = base::spc->geo.sqdist(p[i], p[j]);
-                                                    if ( r2 < pow(threshold + p[i].radius + p[j].radius, 2))
-                                                    {
-                                                        if ( v[i] )
-                                                            dsasa += sasa[i];
-                                                        if ( v[j] )
-                                                            dsasa += sasa[j];
-                                                        v[i] = v[j] = false;
-                                                    }
-                                                }
+                        if ( candidates(p, g1, s1) && candidates(p, g2, s2))
+                        {
+                            // skip if bounding spheres are out of contact
+                            double rc = s1.radius + s2.radius + threshold + s1.rmax + s2.rmax;
+                            if ( base::spc->geo.sqdist(p[s1.index[0]], p[s2.index[0]]) < rc * rc )
+                            {
+                                v.resize(p.size());
+                                std::fill(v.begin(), v.end(), true);
+                                for ( auto i : s1.index )
+                                    for ( auto j : s2.index )
+                                        if ( v[i] || v[j] )
+                                        {
+                                            double r2 = base::spc->geo.sqdist(p[i], p[j]);
+                                            if ( r2 < pow(threshold + p[i].radius + p[j].radius, 2))
+                                            {
+                                                if ( v[i] )
+                                                    dsasa += sasa[i];
+                                                if ( v[j] )
+                                                    dsasa += sasa[j];
+                                                v[i] = v[j] = false;
+                                            }
+                                        }
+                            }
+                        }
                         // analyze
                         if ( sample_uofr && !base::isTrial(p))
                         {
@@ -2976,7 +3661,262 @@ namespace Faunus
         }
     };
 
+/**
+ * @brief Incremental solvent accessible surface area (SASA) of particles
+ *
+ * Particles are treated as spheres with radius `radius+probe` that are
+ * binned in a `Geometry::CellList`. After a full calculation with `init()`,
+ * `propose()` recalculates only the areas of particles overlapping with
+ * moved particles in either the old or the new configuration. The proposal
+ * is kept until `accept()` or `reject()` is called. Since the area of a
+ * particle depends only on spheres overlapping with it, the change equals
+ * that of a full recalculation.
+ *
+ * Areas are calculated numerically by counting exposed points on each
+ * sphere (Shrake-Rupley, doi:10.1016/0022-2836(73)90011-9) or, if compiled
+ * with `ENABLE_POWERSASA` and requested, analytically using PowerSasa.
+ * In both cases neighbours are taken as minimum images so that periodic
+ * boundaries are respected; PowerSasa is therefore called separately for
+ * each affected sphere and its overlapping neighbours.
+ */
+template<class Tgeometry>
+class IncrementalSASA {
+    private:
+        double probe;                   // probe radius (angstrom)
+        double rmax;                    // largest sphere radius (angstrom)
+        bool analytic;                  // use PowerSasa
+        std::vector<Point> sphere;      // points on unit sphere
+        std::vector<Point> pos;         // accepted positions
+        std::vector<double> rad;        // accepted sphere radii
+        std::vector<double> area;       // accepted areas (angstrom^2)
+        std::vector<int> moved;         // proposed moved particles
+        std::vector<std::pair<Point, double>> newpos; // proposed position and sphere radius of `moved`
+        std::vector<int> affected;      // proposed particles with new area
+        std::vector<double> newarea;    // proposed area of `affected`
+        std::vector<char> mark;
+        std::vector<std::pair<Point, double>> nb; // neighbour position relative to sphere and radius^2
+        Geometry::CellList cells;
+
+        /** @brief Periodic geometries must use their box; any box works for others */
+        template<class Tpvec>
+            Point boxlen(Tgeometry &geo, const Tpvec &p) const {
+                auto cuboid = dynamic_cast<const Geometry::Cuboid*>(&geo);
+                if (cuboid!=nullptr)
+                    return cuboid->len;
+                Point len(1,1,1);
+                for (auto &a : p)
+                    len = len.cwiseMax( 2*a.cwiseAbs() + Point(1,1,1)*4*rmax );
+                return len;
+            }
+
+        /** @brief Visit particles in `p` whose sphere overlaps with that of `k` */
+        template<class Tpvec, class Tfunc>
+            void forOverlapping(Tgeometry &geo, const Tpvec &p, int k, Tfunc f) const {
+                double rk = p[k].radius + probe;
+                cells.forNeighbours(p[k], rk+rmax, [&](int j) {
+                        if (j!=k) {
+                        double rkj = rk + p[j].radius + probe;
+                        if (geo.sqdist(p[j],p[k]) < rkj*rkj)
+                        f(j);
+                        }
+                        });
+            }
+
+        /** @brief Shrake-Rupley area of particle `k` (cell list must match `p`) */
+        template<class Tpvec>
+            double calcArea(Tgeometry &geo, const Tpvec &p, int k) {
+                double rk = p[k].radius + probe;
+                nb.clear();
+                forOverlapping(geo, p, k, [&](int j) {
+                        nb.push_back({ geo.vdist(p[j],p[k]), std::pow(p[j].radius+probe,2) }); });
+                int exposed=0;
+                size_t last=0; // last burying neighbour is tested first
+                for (auto &u : sphere) {
+                    Point x = rk*u;
+                    bool buried=false;
+                    if (!nb.empty() && (x-nb[last].first).squaredNorm() < nb[last].second)
+                        buried=true;
+                    else
+                        for (size_t n=0; n<nb.size(); n++)
+                            if ((x-nb[n].first).squaredNorm() < nb[n].second) {
+                                buried=true;
+                                last=n;
+                                break;
+                            }
+                    if (!buried)
+                        exposed++;
+                }
+                return 4*pc::pi*rk*rk*exposed/sphere.size();
+            }
+
+        /** @brief Calculate areas of particles in `index` (cell list must match `p`) */
+        template<class Tpvec>
+            void calcAreas(Tgeometry &geo, const Tpvec &p, const std::vector<int> &index, std::vector<double> &out) {
+                out.resize(index.size());
+#ifdef FAU_POWERSASA
+                if (analytic) {
+                    // sphere at origin followed by minimum images of its neighbours
+                    for (size_t n=0; n<index.size(); ++n) {
+                        int i = index[n];
+                        vector<Point> coords(1, Point(0,0,0));
+                        vector<double> weights(1, p[i].radius + probe);
+                        forOverlapping(geo, p, i, [&](int j) {
+                                coords.push_back( geo.vdist(p[j],p[i]) );
+                                weights.push_back( p[j].radius + probe ); });
+                        POWERSASA::PowerSasa<double,Point> ps(coords, weights, 1, 1, 1, 1);
+                        ps.calc_sasa_all();
+                        out[n] = ps.getSasa()[0];
+                    }
+                    return;
+                }
+#endif
+                for (size_t n=0; n<index.size(); ++n)
+                    out[n] = calcArea(geo, p, index[n]);
+            }
+
+    public:
+        /**
+         * @param probe Probe radius (angstrom)
+         * @param points Number of points per sphere in the numerical calculation
+         * @param analytic Use PowerSasa if available
+         */
+        IncrementalSASA(double probe=1.4, int points=400, bool analytic=false) : probe(probe), rmax(0) {
 #ifdef FAU_POWERSASA
+            this->analytic = analytic;
+#else
+            this->analytic = false;
+#endif
+            if (points<1)
+                throw std::runtime_error("SASA: number of sphere points must be positive");
+            sphere.resize(points); // golden section spiral
+            for (int i=0; i<points; i++) {
+                double z = 1 - (2*i+1.0)/points;
+                double r = std::sqrt(1-z*z);
+                double phi = i * pc::pi * (3-std::sqrt(5.0));
+                sphere[i] = Point( r*std::cos(phi), r*std::sin(phi), z );
+            }
+        }
+
+        bool isAnalytic() const { return analytic; }
+
+        int points() const { return sphere.size(); }
+
+        /** @brief Number of particles */
+        size_t size() const { return pos.size(); }
+
+        /** @brief Accepted area of i'th particle */
+        double operator[](int i) const { return area[i]; }
+
+        /** @brief Total accepted area */
+        double total() const { return std::accumulate(area.begin(), area.end(), 0.0); }
+
+        /** @brief Full calculation for particle vector `p` */
+        template<class Tpvec>
+            void init(Tgeometry &geo, const Tpvec &p) {
+                size_t n = p.size();
+                rmax=0;
+                for (auto &a : p)
+                    rmax = std::max(rmax, a.radius+probe);
+                Point len = boxlen(geo, p);
+                cells.setCellSize( std::max(2*rmax, 0.01*len.maxCoeff()) ); // at most 100^3 cells
+                cells.reset(len);
+                pos.resize(n);
+                rad.resize(n);
+                std::vector<int> all(n);
+                for (size_t i=0; i<n; i++) {
+                    pos[i] = p[i];
+                    rad[i] = p[i].radius + probe;
+                    all[i] = i;
+                    cells.insert(i, p[i]);
+                }
+                calcAreas(geo, p, all, area);
+                mark.assign(n, 0);
+                moved.clear();
+                affected.clear();
+            }
+
+        /**
+         * @brief Propose that particles in `index` have moved to their positions in `p`
+         *
+         * Particle positions not in `index` must match the accepted ones. A
+         * pending proposal is rejected first.
+         *
+         * @param w Weight of a particle, `w(i)`
+         * @returns Weighted area change, \f$\sum_i w_i \Delta a_i\f$
+         */
+        template<class Tpvec, class Tweight>
+            double propose(Tgeometry &geo, const Tpvec &p, const std::vector<int> &index, Tweight w) {
+                assert(p.size()==pos.size());
+                reject();
+                moved = index;
+                for (auto i : moved)
+                    mark[i]=1;
+                affected = moved;
+                auto add = [&](int j) {
+                    if (!mark[j]) {
+                        mark[j]=1;
+                        affected.push_back(j);
+                    }
+                };
+                for (auto i : moved) // overlapping in old configuration
+                    cells.forNeighbours(pos[i], rad[i]+rmax, [&](int j) {
+                            double r = rad[i] + p[j].radius + probe;
+                            if (geo.sqdist(pos[i],p[j]) < r*r)
+                            add(j);
+                            });
+                newpos.clear();
+                for (auto i : moved) {
+                    rmax = std::max(rmax, p[i].radius+probe);
+                    newpos.push_back({ p[i], p[i].radius+probe });
+                    cells.move(i, p[i]);
+                }
+                for (auto i : moved) // overlapping in new configuration
+                    forOverlapping(geo, p, i, add);
+                calcAreas(geo, p, affected, newarea);
+                double du=0;
+                for (size_t n=0; n<affected.size(); n++) {
+                    int i = affected[n];
+                    mark[i]=0;
+                    du += w(i) * (newarea[n]-area[i]);
+                }
+                return du;
+            }
+
+        /** @brief Particles in `p` whose position or radius differ from the accepted ones */
+        template<class Tpvec>
+            std::vector<int> difference(const Tpvec &p) const {
+                assert(p.size()==pos.size());
+                std::vector<int> v;
+                for (size_t i=0; i<p.size(); ++i)
+                    if (p[i]!=pos[i] || p[i].radius+probe!=rad[i])
+                        v.push_back(i);
+                return v;
+            }
+
+        /** @brief Particles with proposed new areas */
+        const std::vector<int>& changed() const { return affected; }
+
+        /** @brief Keep proposal */
+        void accept() {
+            for (size_t n=0; n<affected.size(); n++)
+                area[affected[n]] = newarea[n];
+            for (size_t n=0; n<moved.size(); n++) {
+                pos[moved[n]] = newpos[n].first;
+                rad[moved[n]] = newpos[n].second;
+            }
+            moved.clear();
+            affected.clear();
+        }
+
+        /** @brief Discard proposal */
+        void reject() {
+            for (auto i : moved)
+                cells.move(i, pos[i]);
+            moved.clear();
+            affected.clear();
+        }
+};
+
 /**
  * @brief SASA energy from transfer free energies
  *
@@ -2991,23 +3931,34 @@ namespace Faunus
  *  :------------ | :------------------------------------------------
  *  `proberadius` | Radius of probe (default: 1.4 angstrom)
  *  `molarity`    | Molar concentration of co-solute
+ *  `points`      | Points per atom in numerical SASA (default: 400)
+ *  `powersasa`   | Use analytical PowerSasa if compiled in (default: false)
+ *
+ * Areas are kept in an `IncrementalSASA` object so that only atoms
+ * overlapping with moved atoms are recalculated. The trial area is
+ * proposed in `updateChange()`, or when first needed, and accepted
+ * or discarded in `update()`.
  *
  * For more information see: http://dx.doi.org/10.1002/jcc.21844
  */
 template<class Tspace>
 class SASAEnergy : public Energybase<Tspace> {
     private:
+        typedef Energybase<Tspace> base;
+        typedef typename base::Tpvec Tpvec;
+        typedef IncrementalSASA<typename Tspace::GeometryType> Tsasa;
+
         vector<double> tfe; // transfer free energies (1/angstrom^2)
-        vector<double> sasa; // transfer free energies (1/angstrom^2)
-        vector<Point> sasaCoords;
-        vector<double> sasaWeights;
+        Tsasa sasa;
         double probe; // sasa probe radius (angstrom)
         double conc;  // co-solute concentration (mol/l)
+        double u;     // energy of accepted configuration (kT)
+        double du;    // proposed energy change (kT)
+        bool proposed;       // true if trial areas are proposed
+        bool full;           // true if all particles may have changed
+        std::vector<int> index; // moved particles in current change
         Average<double> avgArea; // average surface area
 
-        typedef Energybase<Tspace> base;
-        typedef typename base::Tpvec Tpvec;
-
         string _info() override {
             char w=20;
             std::ostringstream o;
@@ -3015,69 +3966,128 @@ class SASAEnergy : public Energybase<Tspace> {
                 << probe << textio::_angstrom << "\n"
                 << textio::pad(textio::SUB,w,"Co-solute conc.")
                 << conc << " mol/l\n"
+                << textio::pad(textio::SUB,w,"Method")
+                << (sasa.isAnalytic() ? string("PowerSasa") :
+                        "Shrake-Rupley ("+std::to_string(sasa.points())+" points)") << "\n"
                 << textio::pad(textio::SUB,w,"Average area")
                 << avgArea.avg() << textio::_angstrom+textio::squared << "\n";
             return o.str();
         }
 
-        template<class Tpvec>
-            void updateSASA(const Tpvec &p) {
-                size_t n=p.size(); // number of particles
-                sasa.resize(n);
-                sasaCoords.resize(n);
-                sasaWeights.resize(n);
-
-                for (size_t i=0; i<n; ++i) {
-                    sasaCoords[i]  = p[i];
-                    sasaWeights[i] = p[i].radius + probe;
-                }
+        static vector<double> transferFreeEnergies(const Tpvec &p) {
+            vector<double> v(p.size());
+            for (size_t i=0; i<p.size(); ++i)
+                v[i] = atom[ p[i].id ].tfe / (pc::kT() * pc::Nav); // -> kT
+            return v;
+        }
 
-                // generate powersasa object and calc. sasa for all particles
-                POWERSASA::PowerSasa<double,Point> ps(sasaCoords, sasaWeights, 1, 1, 1, 1);
-                ps.calc_sasa_all();
-                for (size_t i=0; i<n; ++i)
-                    sasa[i] = ps.getSasa()[i];
-            }
+        double energy(const Tsasa &s, const vector<double> &w) const {
+            double e=0;
+            for (size_t i=0; i<w.size(); ++i)
+                e += s[i] * w[i]; // a^2 * kT/a^2/M -> kT/M
+            return e * conc; // -> kT
+        }
+
+        /** @brief Full calculation for accepted configuration */
+        void init() {
+            tfe = transferFreeEnergies(base::spc->p);
+            sasa.init(base::spc->geo, base::spc->p);
+            u = energy(sasa, tfe);
+            proposed = false;
+        }
+
+        /** @brief Propose moved particles in trial configuration */
+        void propose(const std::vector<int> &moved) {
+            du = sasa.propose( base::spc->geo, base::spc->trial, moved,
+                    [&](int i) { return tfe[i]*conc; } );
+            proposed = true;
+        }
 
     public:
-        SASAEnergy(Tmjson &j, const string &dir="sasaenergy") : base(dir) {
+        SASAEnergy(Tmjson &j, const string &dir="sasaenergy") : base(dir), u(0), du(0), proposed(false), full(false) {
             base::name = "SASA Energy";
             auto _j = j["energy"][dir];
             probe = _j.value( "proberadius", 1.4 ); // angstrom
             conc = _j.at("molarity");         // co-solute concentratil (mol/l);
+            sasa = Tsasa( probe, _j.value("points", 400), _j.value("powersasa", false) );
         }
 
         auto tuple() -> decltype(std::make_tuple(this)) {
             return std::make_tuple(this);
         }
 
+        double updateChange(const typename Tspace::Change &c) override {
+            if (proposed)
+                sasa.reject();
+            proposed = false;
+            full = c.geometryChange || !c.inGroup.empty() || !c.rmGroup.empty();
+            index.clear();
+            if (!full && tfe.size()==base::spc->p.size())
+                for (auto &m : c.mvGroup) {
+                    if (m.second.empty()) // all particles in group have moved
+                        for (auto i : *base::spc->groupList()[m.first])
+                            index.push_back(i);
+                    else
+                        index.insert(index.end(), m.second.begin(), m.second.end());
+                }
+            std::sort(index.begin(), index.end());
+            index.erase(std::unique(index.begin(), index.end()), index.end());
+            if (!index.empty())
+                propose(index);
+            return 0;
+        }
+
+        double update(bool acc) override {
+            if (acc && full)
+                init();
+            else if (proposed) {
+                if (acc) {
+                    sasa.accept();
+                    u = energy(sasa, tfe);
+                }
+                else
+                    sasa.reject();
+            }
+            proposed = full = false;
+            return 0;
+        }
+
         /**
          * @brief The SASA calculation is implemented
          * as an external potential, only
+         *
+         * Particle vectors other than `spc->p` and `spc->trial` are
+         * evaluated from scratch.
          */
         double external(const Tpvec &p) override {
-            // if first run, resize and fill tfe vector
-            if (tfe.size()!=p.size()) {
-                tfe.resize(p.size());
-                for (size_t i=0; i<p.size(); ++i)
-                    tfe[i] = atom[ p[i].id ].tfe / (pc::kT() * pc::Nav); // -> kT
+            if (tfe.size()!=base::spc->p.size())
+                init();
+            bool trial = this->isTrial(p);
+            if ((trial && (full || p.size()!=tfe.size())) || (!trial && &p!=&base::spc->p)) {
+                // e.g. volume or particle number change, or a vector unknown
+                // to the incremental calculation: full calculation
+                Tsasa s(sasa);
+                s.init(base::spc->geo, p);
+                return energy(s, transferFreeEnergies(p));
             }
-
-            // calc. sasa and energy
-            updateSASA(p);
-            assert(sasa.size() == p.size());
-            double u=0, A=0;
-            for (size_t i=0; i<sasa.size(); ++i) {
-                u += sasa[i] * tfe[i]; // a^2 * kT/a^2/M -> kT/M
-                if (!this->isTrial(p))
-                    A+=sasa[i];
+            if (trial) {
+                if (!proposed)
+                    propose(sasa.difference(p));
+                return u + du;
             }
-            if (!this->isTrial(p))
-                avgArea+=A; // sample average area for accepted confs. only
-            return u * conc; // -> kT
+            // accepted configuration; catch up with changes made outside update()
+            if (!proposed) {
+                auto moved = sasa.difference(p);
+                if (!moved.empty()) {
+                    sasa.propose( base::spc->geo, p, moved, [](int) { return 0.0; } );
+                    sasa.accept();
+                    u = energy(sasa, tfe);
+                }
+            }
+            avgArea += sasa.total(); // sample average area for accepted confs. only
+            return u;
         }
 };
-#endif
 
     /**
      * @brief Additive Hamiltonian
@@ -3119,11 +4129,11 @@ class SASAEnergy : public Energybase<Tspace> {
 
                     if (i.key()=="coulomb+lj")
                         baselist.push_back( Tptr( new Energy::Nonbonded<Tspace,
-                                    CombinedPairPotential<CoulombGalore, LennardJonesLB>>(j) ) );
+                                    CombinedPairPotential<CoulombGalore, LennardJonesLB>>(j, i.key()) ) );
 
                     if (i.key()=="coulomb+hs")
                         baselist.push_back( Tptr( new Energy::Nonbonded<Tspace,
-                                    CombinedPairPotential<CoulombGalore, HardSphere>>(j) ) );
+                                    CombinedPairPotential<CoulombGalore, HardSphere>>(j, i.key()) ) );
 
                     if ( i.key() == "isobaric" )
                         baselist.push_back( Tptr( new Energy::ExternalPressure<Tspace>( j ) ) );
@@ -3197,7 +4207,7 @@ class SASAEnergy : public Energybase<Tspace> {
         {
             double u = 0;
             for ( auto b : baselist )
-                u += b->all2p(p, a);
+                u += FAU_PROFILE_CALL(*b, all2p, p, a);
             return u;
         }
 
@@ -3206,7 +4216,7 @@ class SASAEnergy : public Energybase<Tspace> {
         {
             double u = 0;
             for ( auto b : baselist )
-                u += b->i2i(p, i, j);
+                u += FAU_PROFILE_CALL(*b, i2i, p, i, j);
             return u;
         }
 
@@ -3214,7 +4224,7 @@ class SASAEnergy : public Energybase<Tspace> {
         {
             double u = 0;
             for ( auto b : baselist )
-                u += b->i2g(p, g, i);
+                u += FAU_PROFILE_CALL(*b, i2g, p, g, i);
             return u;
         }
 
@@ -3222,7 +4232,7 @@ class SASAEnergy : public Energybase<Tspace> {
         {
             double u = 0;
             for ( auto b : baselist )
-                u += b->i2all(p, i);
+                u += FAU_PROFILE_CALL(*b, i2all, p, i);
             return u;
         }
 
@@ -3230,7 +4240,7 @@ class SASAEnergy : public Energybase<Tspace> {
         {
             double u = 0;
             for ( auto b : baselist )
-                u += b->i_external(p, i);
+                u += FAU_PROFILE_CALL(*b, i_external, p, i);
             return u;
         }
 
@@ -3238,7 +4248,15 @@ class SASAEnergy : public Energybase<Tspace> {
         {
             double u = 0;
             for ( auto b : baselist )
-                u += b->i_internal(p, i);
+                u += FAU_PROFILE_CALL(*b, i_internal, p, i);
+            return u;
+        }
+
+        double p_external( const Tparticle &a ) override
+        {
+            double u = 0;
+            for ( auto b : baselist )
+                u += FAU_PROFILE_CALL(*b, p_external, a);
             return u;
         }
 
@@ -3247,7 +4265,7 @@ class SASAEnergy : public Energybase<Tspace> {
         {
             double u = 0;
             for ( auto b : baselist )
-                u += b->g2g(p, g1, g2);
+                u += FAU_PROFILE_CALL(*b, g2g, p, g1, g2);
             return u;
         }
 
@@ -3262,7 +4280,7 @@ class SASAEnergy : public Energybase<Tspace> {
             double u = 0;
             for ( auto b = baselist.rbegin(); b != baselist.rend(); ++b )
             {
-                u += (*b)->g_external(p, g);
+                u += FAU_PROFILE_CALL(**b, g_external, p, g);
                 if ( u >= pc::infty )
                     break;
             }
@@ -3273,7 +4291,15 @@ class SASAEnergy : public Energybase<Tspace> {
         {
             double u = 0;
             for ( auto b : baselist )
-                u += b->g_internal(p, g);
+                u += FAU_PROFILE_CALL(*b, g_internal, p, g);
+            return u;
+        }
+
+        double g_internal_subset( const Tpvec &p, Group &g, const std::vector<int> &index ) override
+        {
+            double u = 0;
+            for ( auto b : baselist )
+                u += FAU_PROFILE_CALL(*b, g_internal_subset, p, g, index);
             return u;
         }
 
@@ -3281,7 +4307,24 @@ class SASAEnergy : public Energybase<Tspace> {
         {
             double u = 0;
             for ( auto b : baselist )
-                u += b->external(p);
+                u += FAU_PROFILE_CALL(*b, external, p);
+            return u;
+        }
+
+        /** @brief Forward acceptance to all terms; as for `CombinedEnergy` the returned energies are summed */
+        double update( bool acc ) override
+        {
+            double u = 0;
+            for ( auto b : baselist )
+                u += FAU_PROFILE_CALL(*b, update, acc);
+            return u;
+        }
+
+        double updateChange( const typename Tspace::Change &c ) override
+        {
+            double u = 0;
+            for ( auto b : baselist )
+                u += FAU_PROFILE_CALL(*b, updateChange, c);
             return u;
         }
 
@@ -3289,7 +4332,7 @@ class SASAEnergy : public Energybase<Tspace> {
         {
             double u = 0;
             for ( auto b : baselist )
-                u += b->v2v(v1, v2);
+                u += FAU_PROFILE_CALL(*b, v2v, v1, v2);
             return u;
         }
 
@@ -3297,7 +4340,7 @@ class SASAEnergy : public Energybase<Tspace> {
         {
             double u = 0;
             for ( auto b : baselist )
-                u += b->g1g2(p1, g2, p2, g2);
+                u += FAU_PROFILE_CALL(*b, g1g2, p1, g2, p2, g2);
             return u;
         }
 
@@ -3316,9 +4359,16 @@ class SASAEnergy : public Energybase<Tspace> {
 
         void field( const Tpvec &p, Eigen::MatrixXd &E ) override
         {
-            assert((int) p.size() == E.size());
+            assert((int) p.size() == E.cols());
+            for ( auto b : baselist )
+                FAU_PROFILE_CALL(*b, field, p, E);
+        }
+
+        void field( const Tpvec &p, Eigen::MatrixXd &E, const std::vector<int> &index ) override
+        {
+            assert((int) p.size() == E.cols());
             for ( auto b : baselist )
-                b->field(p, E);
+                FAU_PROFILE_CALL(*b, field, p, E, index);
         }
 
         /**
@@ -3440,7 +4490,7 @@ class SASAEnergy : public Energybase<Tspace> {
               if ( g[i]->isMolecular() )
               {
                   if (!m.second.empty()) // only recalculate internal energy if N>0
-                     du += pot.g_internal(p, *g[i]);
+                     du += pot.g_internal_subset(p, *g[i], m.second); // terms involving moved particles
               }
           }
 
@@ -3509,6 +4559,28 @@ class SASAEnergy : public Energybase<Tspace> {
 
 
 
+    /**
+     * @brief Pair force on each particle in `index` from all other particles (kT/Angstrom)
+     *
+     * Forces are summed using `Energybase::f_p2p()` and interactions with
+     * particles in `exclude` are skipped. Particles in `index` are handled
+     * in parallel (OpenMP).
+     */
+      template<class Tenergy, class Tpvec>
+      std::vector<Point> forces( Tenergy &pot, const Tpvec &p, const std::vector<int> &index, const Group &exclude )
+      {
+          std::vector<Point> f(index.size(), Point(0, 0, 0));
+#pragma omp parallel for
+          for ( int k = 0; k < (int) index.size(); k++ )
+          {
+              int i = index[k];
+              for ( int j = 0; j < (int) p.size(); j++ )
+                  if ( j != i && !exclude.find(j))
+                      f[k] += pot.f_p2p(p[i], p[j]);
+          }
+          return f;
+      }
+
       /**
    * @brief EnergyTester class to conveniently compare two energy classes together
    *
@@ -3587,6 +4659,8 @@ class SASAEnergy : public Energybase<Tspace> {
 
           double i_internal( const Tpvec &p, int i ) override { return first.i_internal(p, i); }
 
+          double p_external( const Tparticle &a ) override { return first.p_external(a); }
+
           double g2g( const Tpvec &p, Group &g1, Group &g2 ) override
           {
               double a = first.g2g(p, g1, g2);
@@ -3611,6 +4685,11 @@ class SASAEnergy : public Energybase<Tspace> {
               return first.g_internal(p, g);
           }
 
+          double g_internal_subset( const Tpvec &p, Group &g, const std::vector<int> &index ) override
+          {
+              return first.g_internal_subset(p, g, index);
+          }
+
           double external( const Tpvec &p ) override { return first.external(p); }
 
           double update( bool b ) override { return first.update(b) + second.update(b); }
@@ -3623,6 +4702,12 @@ class SASAEnergy : public Energybase<Tspace> {
               second.field(p, E);
           }
 
+          void field( const Tpvec &p, Eigen::MatrixXd &E, const std::vector<int> &index ) override
+          {
+              first.field(p, E, index);
+              second.field(p, E, index);
+          }
+
           double g2All(const Tpvec & p, const std::map<int, vector<int>>& mg) override
           {
               double a = first.g2All(p, mg);
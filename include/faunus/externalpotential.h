@@ -76,6 +76,66 @@ namespace Faunus
                 }
         };
 
+        /**
+         * @brief Cubic Hermite table of a function of a distance coordinate
+         *
+         * The function and its derivative are tabulated with uniform spacing on
+         * `[0,xmax]`, the function is assumed to vanish beyond `xmax`. After
+         * generation the table is checked against the exact function in
+         * between the knots; the region closer than `xmin()`, where the deviation
+         * exceeds the tolerance, should be evaluated exactly.
+         */
+        template<class T=double>
+            class HermiteTable
+            {
+                private:
+                    T hinv=0, xmax=0, xexact=pc::infty;
+                    std::vector<std::array<T, 4>> c; // polynomial coefficients per interval
+
+                    T interpolate( T x ) const
+                    {
+                        T s = x * hinv;
+                        size_t i = size_t(s);
+                        s -= i;
+                        return ((c[i][0] * s + c[i][1]) * s + c[i][2]) * s + c[i][3];
+                    }
+
+                public:
+                    /**
+                     * @param f Function to tabulate
+                     * @param df Derivative of `f`
+                     * @param max Upper bound of the table
+                     * @param h Knot spacing
+                     * @param tol Maximum absolute deviation from `f`
+                     */
+                    void generate( std::function<T( T )> f, std::function<T( T )> df, T max, T h, T tol )
+                    {
+                        size_t n = size_t(std::ceil(max / h));
+                        hinv = 1 / h;
+                        xmax = n * h;
+                        c.resize(n);
+                        for ( size_t i = 0; i < n; i++ )
+                        {
+                            T y0 = f(i * h), y1 = f((i + 1) * h);
+                            T d0 = h * df(i * h), d1 = h * df((i + 1) * h);
+                            c[i] = {{2 * y0 - 2 * y1 + d0 + d1, -3 * y0 + 3 * y1 - 2 * d0 - d1, d0, y0}};
+                        }
+                        xexact = 0;
+                        for ( size_t i = 0; i < n; i++ )
+                            for ( T s : {0.25, 0.5, 0.75} )
+                                if ( std::fabs(interpolate((i + s) * h) - f((i + s) * h)) > tol )
+                                    xexact = (i + 1) * h;
+                    }
+
+                    bool empty() const { return c.empty(); }
+
+                    /** @brief Below this value the table is inaccurate */
+                    T xmin() const { return xexact; }
+
+                    /** @brief Tabulated value; `x` must be larger than or equal to `xmin()` */
+                    T operator()( T x ) const { return (x < xmax) ? interpolate(x) : 0; }
+            };
+
         /**
          * @brief Gouy-Chapman potential
          *
@@ -102,6 +162,11 @@ namespace Faunus
          *     Energy::ExternalPotential<Txp> pot(in);
          *     pot.expot.setSurfPositionZ( &geo.len_half.z() );
          *
+         * The potential is tabulated as a function of surface distance (see
+         * `HermiteTable`) so that no `exp` or `log` is evaluated for particles
+         * away from the surface. For contiguous particle ranges `batch()` sums the
+         * energy directly from the z coordinates.
+         *
          * @note Salt is assumed monovalent
          * @date Lund/Asljunga, 2011-2012
          */
@@ -118,13 +183,22 @@ namespace Faunus
                 T lB;          //!< Bjerrum length (A)
                 T k;           //!< Inv. debye len (1/A)
                 T offset;      //!< Distance offset for hiding GC surface behind the box surface
+                T *zsurf;      //!< Surface position if set with `setSurfPositionZ`
+                HermiteTable<T> table; //!< Reduced potential as a function of surface distance
                 std::string _info();
+                T phi( T ) const;                   //!< Reduced potential, exact
+                T dphi( T ) const;                  //!< Derivative of `phi()`
+
+                /** @brief Reduced potential at surface distance `d` */
+                T potential( T d ) const { return (d < table.xmin()) ? phi(d) : table(d); }
             public:
                 GouyChapman( Tmjson &, const string &sec = "gouychapman" ); //!< Constructor
                 void setSurfPositionZ( T * );       //!< Set surface position on z-axis
                 T surfDist( const Point & );        //!< Point<->GC surface distance
                 template<typename Tparticle>
                     T operator()( const Tparticle & );//!< Particle<->GC interaction energy
+                template<class Tpvec>
+                    T batch( const Tpvec &, int, int );//!< Energy of particles in range [first,last)
 
                 auto tuple() -> decltype(std::make_tuple(this))
                 {
@@ -160,8 +234,38 @@ namespace Faunus
             }
             gamma0 = tanh(phi0 / 4); // assuming z=1  [Evans..]
             offset = js.value("offset", 0.0);
+            zsurf = nullptr;
+            if ( k > 0 )
+                table.generate(
+                    [&]( T d ) { return phi(d); }, [&]( T d ) { return dphi(d); },
+                    30 / k, 0.02 / k, 1e-9);
         }
 
+        /**
+         * @details Interaction of unit charge with GC potential:
+         * @f[ \beta e \Phi(r_i) = 2\ln{\frac{1+\Gamma_0 \exp{-\kappa r_i}}{1-\Gamma_0 \exp{-\kappa r_i}}}@f]
+         * where `r_i` is the distance from the surface.
+         */
+        template<class T, bool linearize>
+            T GouyChapman<T, linearize>::phi( T d ) const
+            {
+                T x = exp(-k * d);
+                if ( linearize )
+                    return phi0 * x;
+                x = gamma0 * x;
+                return 2 * log((1 + x) / (1 - x));
+            }
+
+        template<class T, bool linearize>
+            T GouyChapman<T, linearize>::dphi( T d ) const
+            {
+                T x = exp(-k * d);
+                if ( linearize )
+                    return -k * phi0 * x;
+                x = gamma0 * x;
+                return -4 * k * x / (1 - x * x);
+            }
+
         /**
          * Before using this function make sure to set a surface calculations
          * method either with `setSurfPositionZ` or `setSurfPositionZ`.
@@ -176,6 +280,7 @@ namespace Faunus
         template<class T, bool linearize>
             void GouyChapman<T, linearize>::setSurfPositionZ( T *z )
             {
+                zsurf = z;
                 setCoordinateFunc
                     (
                      [=]( const Point &p ) { return std::abs(*z - p.z()) + offset; }
@@ -184,7 +289,6 @@ namespace Faunus
 
         /**
          * @details Interaction of charged particle with GC potential:
-         * @f[ \beta e \Phi(r_i) = 2\ln{\frac{1+\Gamma_0 \exp{-\kappa r_i}}{1-\Gamma_0 \exp{-\kappa r_i}}}@f]
          * @f[ \beta u = z_i \cdot \beta e \Phi(r_i) @f]
          * where `z_i` is the charge number and `r_i` the distance from the surface.
          */
@@ -193,21 +297,30 @@ namespace Faunus
             T GouyChapman<T, linearize>::operator()( const Tparticle &p )
             {
                 if ( p.charge != 0 )
+                    return p.charge * potential(surfDist(p));
+                return 0;
+            }
+
+        /**
+         * If the surface was set with `setSurfPositionZ` the distances are
+         * calculated inline rather than through the coordinate function.
+         */
+        template<class T, bool linearize>
+            template<class Tpvec>
+            T GouyChapman<T, linearize>::batch( const Tpvec &p, int first, int last )
+            {
+                T u = 0;
+                if ( zsurf != nullptr )
                 {
-#ifdef FAU_APPROXMATH
-                    T x=exp_cawley(-k*surfDist(p));
-#else
-                    T x = exp(-k * surfDist(p));
-#endif
-                    if ( linearize )
-                        return p.charge * phi0 * x;
-                    else
-                    {
-                        x = gamma0 * x;
-                        return 2 * p.charge * log((1 + x) / (1 - x));
-                    }
+                    T z = *zsurf;
+                    for ( int i = first; i < last; i++ )
+                        if ( p[i].charge != 0 )
+                            u += p[i].charge * potential(std::abs(z - p[i].z()) + offset);
                 }
-                return 0;
+                else
+                    for ( int i = first; i < last; i++ )
+                        u += operator()(p[i]);
+                return u;
             }
 
         template<class T, bool linearize>
@@ -436,11 +549,17 @@ namespace Faunus
                 std::string _info();
                 enum InteractionType { SQWL, LJ, R6, R3, LINEAR }; //
                 InteractionType _type;                           // faster than evaluating strings
+                T *zsurf;                                        // surface position, if set
+                T energy( T, T ) const;                          // energy at distance and radius
+                template<class Tpvec>
+                    T sum( const Tpvec &, int, int, bool );      // energy of range, optionally hydrophobic only
             public:
                 StickyWall( Tmjson & );
                 void setSurfPositionZ( T * );                       // sets position of surface
                 template<typename Tparticle>
                     T operator()( const Tparticle &p );              // returns energy
+                template<class Tpvec>
+                    T batch( const Tpvec &p, int first, int last ) { return sum(p, first, last, false); }
         };
 
         template<class T>
@@ -465,59 +584,85 @@ namespace Faunus
 
                 if ( _depth < 0 )
                     throw std::runtime_error("Square well depth must be positive.");
+                zsurf = nullptr;
             }
 
         template<class T>
             void StickyWall<T>::setSurfPositionZ( T *z )
             {
+                zsurf = z;
                 this->setCoordinateFunc
                     (
                      [=]( const Point &p ) { return std::abs(*z - p.z()); }
                     );                                               // c++11 lambda
             }
 
+        /**
+         * @param d Particle center-to-wall distance
+         * @param radius Particle radius
+         */
+        template<class T>
+            T StickyWall<T>::energy( T d, T radius ) const
+            {
+                double value = 0;
+                if ( _type == SQWL )
+                {
+                    if ( d < _threshold )                 // wall collision doesn't let d be < 0, hence it will never be accepted that _threshold < 0
+                        value = -1;
+                }
+                else if ( _type == LJ )
+                {
+                    double r1 = radius / (d + radius);
+                    double r6 = r1 * r1 * r1 * r1 * r1 * r1;
+                    value = ((r6 * r6) - (2 * r6));
+                }
+                else if ( _type == R6 )
+                {
+                    double r1 = radius / (d + radius);
+                    double r6 = r1 * r1 * r1 * r1 * r1 * r1;
+                    value = -r6;
+                }
+                else if ( _type == R3 )
+                {
+                    double r1 = radius / (d + radius);
+                    double r3 = r1 * r1 * r1;
+                    value = -r3;
+                }
+                else if ( _type == LINEAR )
+                {
+                    if ( d < _threshold )
+                        value = -(1 - (d / _threshold));
+                }
+                return _depth * value;
+            }
+
         template<class T>
             template<typename Tparticle>
             T StickyWall<T>::operator()( const Tparticle &p )
             {
                 assert(this->p2c != nullptr && "Did you call `setSurfPositionZ()` ?");
-                if ( _depth > 1e-6 )
-                {                               // save CPU cycles if _depth is zero
-                    double value = 0;
-                    if ( _type == SQWL )
-                    {
-                        if ( this->p2c(p)
-                                < _threshold )                 // wall collision doesn't let this->p2c(p) be < 0, hence it will never be accepted that _threshold < 0
-                            value = -1;
-                    }
-                    else if ( _type == LJ )
-                    {
-                        double r1 = p.radius / (this->p2c(p) + p.radius);
-                        double r6 = r1 * r1 * r1 * r1 * r1 * r1;
-                        value = ((r6 * r6) - (2 * r6));
-                    }
-                    else if ( _type == R6 )
-                    {
-                        double r1 = p.radius / (this->p2c(p) + p.radius);
-                        double r6 = r1 * r1 * r1 * r1 * r1 * r1;
-                        value = -r6;
-                    }
-                    else if ( _type == R3 )
-                    {
-                        double r1 = p.radius / (this->p2c(p) + p.radius);
-                        double r3 = r1 * r1 * r1;
-                        value = -r3;
-                    }
-                    else if ( _type == LINEAR )
-                    {
-                        if ( this->p2c(p) < _threshold )
-                            value = -(1 - (this->p2c(p) / _threshold));
-                    }
-                    return _depth * value;
-                }
+                if ( _depth > 1e-6 )                               // save CPU cycles if _depth is zero
+                    return energy(this->p2c(p), p.radius);
                 return 0;
             }
 
+        /**
+         * Energy of particles in `[first,last)`. The wall distance is calculated
+         * inline when the surface was set with `setSurfPositionZ`.
+         */
+        template<class T>
+            template<class Tpvec>
+            T StickyWall<T>::sum( const Tpvec &p, int first, int last, bool hydrophobic )
+            {
+                assert(this->p2c != nullptr && "Did you call `setSurfPositionZ()` ?");
+                T u = 0;
+                if ( _depth > 1e-6 )
+                    for ( int i = first; i < last; i++ )
+                        if ( !hydrophobic || p[i].hydrophobic )
+                            u += energy((zsurf != nullptr) ? std::abs(*zsurf - p[i].z()) : this->p2c(p[i]), p[i].radius);
+                return u;
+            }
+
         template<class T>
             std::string StickyWall<T>::_info()
             {
@@ -569,6 +714,12 @@ namespace Faunus
                 {
                     return (p.hydrophobic) ? StickyWall<T>::operator()(p) : 0;
                 }
+
+            template<class Tpvec>
+                T batch( const Tpvec &p, int first, int last )
+                {
+                    return StickyWall<T>::sum(p, first, last, true);
+                }
         };
 
         /*!
@@ -585,21 +736,42 @@ namespace Faunus
          * energy drifts, update() returns the energy change brought about by updating the charge profile.
          * This class should be used in conjunction with an interaction class (energybase derivative) to
          * take inte account explicit interactions within the container.
+         * If the box height changes, e.g. in the isobaric ensemble, the accumulated charge profile
+         * and the potential are stretched to the new height rather than discarded.
          *
          * \warning Update July 2017: This is a quick and dirty conversion from a 2010 commit;
          * double check your results.
          */
-        template<class T=double>                                                                                                                                           
+        template<class T=double>
             class ExternalAkesson : public ExternalPotentialBase<> { 
                 private:
                     bool loadfromdisk=false;
                     unsigned int cnt=0;                     //!< Number of charge density updates
                     double dz=0.1;                          //!< z spacing between slits (A)
                     double lB;                              //!< Bjerrum length (A)
-                    Table2D<double, Average<double>> rho;   //!< Charge density at z (unit A^-2)
-                    Table2D<double, double> phi;            //!< External potential at z (unit: beta*e)
-
-                    double getPotential(const Point &a) { return phi(a.z()); }
+                    double zmin=0;                          //!< z of first slit (A)
+                    double height=0;                        //!< Box height of `Q` and `phi` (A)
+                    double kernel_a=-1;                     //!< Half box side used for `kernel`
+                    std::vector<double> Q;                  //!< Summed charge per slit (unit e)
+                    std::vector<double> kernel;             //!< phi_ext(n*dz, a) for slit separation n
+                    std::vector<double> phi;                //!< External potential at slit n (unit: beta*e)
+
+                    /**
+                     * Linear interpolation in `phi` -- O(1) and clamped to the
+                     * first and last slit; zero if not yet calculated.
+                     */
+                    double getPotential(const Point &a) {
+                        if (phi.empty())
+                            return 0;
+                        double x = (a.z()-zmin) / dz;
+                        if (x <= 0)
+                            return phi.front();
+                        size_t n = size_t(x);
+                        if (n+1 >= phi.size())
+                            return phi.back();
+                        x -= n;
+                        return (1-x)*phi[n] + x*phi[n+1];
+                    }
 
                     //!< This is Eq. 15 of the mol. phys. 1996 paper by Greberg et al.
                     //!< (sign typo in manuscript: phi^infty(z) should be "-2*pi*z" on page 413, middle)
@@ -608,10 +780,90 @@ namespace Faunus
                                 2+std::asin((a*a*a*a-z*z*z*z-2*a*a*z*z)/std::pow(a*a+z*z,2)));
                     }
 
+                    /**
+                     * Eq. 14 in the Greberg paper as a discrete convolution,
+                     * `phi_k = lB sum_n <rho_n> phi_ext(|k-n|dz)`. The kernel
+                     * depends only on the slit separation and is tabulated once.
+                     */
+                    void updatePotential(double a, double area) {
+                        size_t N = Q.size();
+                        if (kernel.size()!=N || kernel_a!=a) {
+                            kernel.resize(N);
+                            for (size_t n=0; n<N; n++)
+                                kernel[n] = phi_ext(n*dz, a);
+                            kernel_a = a;
+                        }
+                        std::vector<double> rho(N);
+                        for (size_t n=0; n<N; n++)
+                            rho[n] = Q[n] / (area*cnt);
+                        phi.assign(N, 0);
+                        for (size_t k=0; k<N; k++) {
+                            double s=0;
+                            for (size_t n=0; n<k; n++)
+                                s += rho[n] * kernel[k-n];
+                            for (size_t n=k; n<N; n++)
+                                s += rho[n] * kernel[n-k];
+                            phi[k] = lB*s;
+                        }
+                    }
+
+                    /**
+                     * Stretch the summed charges and the potential from `height`
+                     * to `h`. Charge in each old slit is spread over the new slits
+                     * it overlaps so that the total charge is conserved, while the
+                     * potential is interpolated at the scaled slit positions.
+                     */
+                    void rescale(double h, size_t N) {
+                        double s = h / height;
+                        std::vector<double> Qnew(N, 0);
+                        for (size_t n=0; n<Q.size(); n++) {
+                            double a = n*dz*s, b = a + dz*s; // old slit in new coordinates
+                            for (size_t k=size_t(a/dz); k<N && k*dz<b; k++) {
+                                double overlap = std::min(b, (k+1)*dz) - std::max(a, k*dz);
+                                if (overlap>0)
+                                    Qnew[k] += Q[n] * overlap / (dz*s);
+                            }
+                        }
+                        Q.swap(Qnew);
+                        if (!phi.empty()) {
+                            std::vector<double> phinew(N);
+                            for (size_t k=0; k<N; k++) {
+                                double x = k/s; // old slit index
+                                size_t n = std::min(size_t(x), phi.size()-1);
+                                phinew[k] = (n+1<phi.size()) ? (1-(x-n))*phi[n] + (x-n)*phi[n+1] : phi.back();
+                            }
+                            phi.swap(phinew);
+                        }
+                    }
+
+                    void load(const string &file) {
+                        std::ifstream f(file.c_str());
+                        std::vector<double> z;
+                        double x, y;
+                        while (f >> x >> y) {
+                            z.push_back(x);
+                            phi.push_back(y);
+                        }
+                        if (phi.size()>1) {
+                            zmin = z.front();
+                            dz = z[1]-z[0];
+                        } else
+                            phi.clear();
+                    }
+
+                    void save(const string &file) {
+                        std::ofstream f(file.c_str());
+                        f.precision(10);
+                        if (f)
+                            for (size_t n=0; n<phi.size(); n++)
+                                f << zmin+n*dz << " " << phi[n] << "\n";
+                    }
+
                     string _info() override {
                         std::ostringstream o;
                         o << "   Akesson external potential:\n"
                             << "     Bjerrum length         = " << lB << " A (HARDCODED)\n"
+                            << "     Slit spacing           = " << dz << " A (" << phi.size() << " slits)\n"
                             << "     Number of pot. updates = " << cnt/10 << endl
                             << "     More information:        Mol. Phys. 1996, 87:407\n";
                         return o.str();
@@ -621,8 +873,8 @@ namespace Faunus
                     ExternalAkesson(const Tmjson &j, const string &sec = "gouychapman") {
                         dz = 0.1;
                         lB = 7;
-                        phi.load("akesson.dat");
-                        loadfromdisk = phi.getMap().empty() ? false : true;
+                        load("akesson.dat");
+                        loadfromdisk = phi.empty() ? false : true;
                         if (loadfromdisk)
                             cout << "loaded akesson.dat" << endl;
                         else
@@ -631,9 +883,9 @@ namespace Faunus
 
                     ~ExternalAkesson() {
                         if (loadfromdisk==false)
-                            if (!phi.getMap().empty())
+                            if (!phi.empty())
                             {
-                                phi.save("akesson.dat");
+                                save("akesson.dat");
                                 cout << "saved akesson.dat to disk" << endl;
                             }
                     }
@@ -646,34 +898,35 @@ namespace Faunus
                     /*!
                      * \brief Updated xy-slit charge densities as well as the potential along z.
                      * \param c Cuboid container where charged particles are sought out and averaged
-                     * \return Energy change of updating the external potential (use to avoid energy drifts)
+                     *
+                     * Particles are binned into slits in a single pass; the
+                     * potential is occasionally recalculated from the averaged
+                     * charge densities.
                      */
                     template<class Tspace>
                         void sample(const Tspace &spc) {
                             if (loadfromdisk==false) {
-                                cnt++;
                                 Point len_half = spc.geo.len_half;
-                                double area = spc.geo.len.x() * spc.geo.len.y();
-                                for (double z=-len_half.z(); z<=len_half.z(); z+=dz) { // update rho(z)
-                                    double Q=0;
-                                    for (size_t i=0; i<spc.p.size(); i++)
-                                        if (spc.p[i].z() >= z)
-                                            if (spc.p[i].z() < z+dz )
-                                                Q+=spc.p[i].charge;
-                                    rho(z) += Q / area; 
+                                size_t N = size_t(2*len_half.z()/dz) + 1;
+                                if (Q.empty()) {
+                                    Q.assign(N, 0);
+                                    height = 2*len_half.z();
                                 }
-
-                                if (slump()>0.99) {
-                                    double a=len_half.x();
-                                    for (double z=-len_half.z(); z<=len_half.z(); z+=dz) {
-                                        double s=0;
-                                        for (double zn=-len_half.z(); zn<=len_half.z(); zn+=dz)
-                                            if (rho(zn).cnt>0)
-                                                s += rho(zn).avg() * phi_ext( std::fabs(z-zn), a );  // Eq. 14 in Greberg paper
-                                            else s+=0;
-                                        phi(z) = lB*s;
-                                    }
+                                else if (height != 2*len_half.z()) { // new box height
+                                    rescale(2*len_half.z(), N);
+                                    height = 2*len_half.z();
                                 }
+                                cnt++;
+                                zmin = -len_half.z();
+                                for (auto &i : spc.p)
+                                    if (i.charge!=0) {
+                                        double x = (i.z()-zmin) / dz;
+                                        if (x>=0 && x<N)
+                                            Q[size_t(x)] += i.charge;
+                                    }
+
+                                if (slump()>0.99)
+                                    updatePotential(len_half.x(), spc.geo.len.x() * spc.geo.len.y());
                             }
                         }
             };
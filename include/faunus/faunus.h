@@ -29,6 +29,7 @@
 #include <faunus/species.h>
 #include <faunus/inputfile.h>
 #include <faunus/energy.h>
+#include <faunus/profiler.h>
 #include <faunus/potentials.h>
 #include <faunus/multipole.h>
 #include <faunus/externalpotential.h>
@@ -42,7 +42,9 @@ namespace Faunus
      *       may have negative impact on performance as function inlining may not be
      *       possible. This is usually a problem only for inner loop distance calculations.
      *       To get optimum performance in inner loops use a derived class directly and do
-     *       static, compile-time polymorphism (templates).
+     *       static, compile-time polymorphism (templates). Geometries without further
+     *       specializations are declared `final` so that calls are bound at compile time
+     *       also through pointers and references.
      */
     class Geometrybase
     {
@@ -53,9 +55,33 @@ namespace Faunus
 	virtual double _getRadius() const;
     protected:
         string name;                                        //!< Name of the geometry
-        inline int anint( double x ) const
+        /**
+         * @brief Round to nearest integer without branching
+         *
+         * Adding and subtracting 1.5x2^52 pushes all fractional bits out of
+         * the mantissa, i.e. the FPU does the rounding (halfway cases to even).
+         * Valid for |x|<2^51 and requires IEEE arithmetic which is why
+         * `-ffast-math` falls back to `std::round()`.
+         */
+        inline double anint( double x ) const
         {
-            return int(x > 0. ? x + .5 : x - .5);
+#ifdef __FAST_MATH__
+            return std::round(x);
+#else
+            const double c = 6755399441055744.0;
+            return (x + c) - c;
+#endif
+        }
+
+        /** @brief Element-wise `anint()` */
+        inline Eigen::Array3d anint( const Eigen::Array3d &x ) const
+        {
+#ifdef __FAST_MATH__
+            return x.unaryExpr([]( double v ) { return std::round(v); });
+#else
+            const double c = 6755399441055744.0;
+            return (x + c) - c;
+#endif
         }
 
     public:
@@ -93,7 +119,7 @@ namespace Faunus
      *
      * This is a spherical-surface simulation container.
      */
-    class SphereSurface : public Geometrybase 
+    class SphereSurface final : public Geometrybase 
     {
       private:
         double r,r2,diameter;
@@ -136,7 +162,7 @@ namespace Faunus
      *
      * This is a spherical simulation container, surrounded by a hard wall.
      */
-    class Sphere : public Geometrybase
+    class Sphere final : public Geometrybase
     {
     private:
         double r, r2, diameter;
@@ -199,7 +225,7 @@ namespace Faunus
 
         Cuboid( Tmjson & ); //!< Construct from JSON input
 
-        void setlen( const Point & );               //!< Reset Cuboid sidelengths
+        virtual void setlen( const Point & );       //!< Reset Cuboid sidelengths
         Point len;                               //!< Sidelengths
         Point len_half;                          //!< Half sidelength
         Point randompos();
@@ -219,47 +245,32 @@ namespace Faunus
         /**
          * For reviews of minimum image algorithms,
          * see doi:10/ck2nrd and doi:10/kvs
+         *
+         * The image is found by rounding rather than by comparison
+         * with the half box length, which avoids poorly predicted
+         * branches for random pairs.
          */
         inline double sqdist( const Point &a, const Point &b ) const override
         {
-            Point d = (a - b).cwiseAbs();
-            for ( int i = 0; i < 3; ++i )
-                if ( d[i] > len_half[i] )
-                    d[i] -= 2 * len_half[i];
-            return d.squaredNorm();
-
-            // Alternative algorithm:
-            // Eigen::Vector3d d = a-b;
-            // Eigen::Vector3i k = (2*d.cwiseProduct(len_inv)).cast<int>();
-            // return (d-k.cast<double>().cwiseProduct(len)).squaredNorm();
+            double dx = a.x() - b.x();
+            double dy = a.y() - b.y();
+            double dz = a.z() - b.z();
+            dx -= len.x() * anint(dx * len_inv.x());
+            dy -= len.y() * anint(dy * len_inv.y());
+            dz -= len.z() * anint(dz * len_inv.z());
+            return dx * dx + dy * dy + dz * dz;
         }
 
         inline Point vdist( const Point &a, const Point &b ) override
         {
             Point r = a - b;
-            if ( r.x() > len_half.x())
-                r.x() -= len.x();
-            else if ( r.x() < -len_half.x())
-                r.x() += len.x();
-            if ( r.y() > len_half.y())
-                r.y() -= len.y();
-            else if ( r.y() < -len_half.y())
-                r.y() += len.y();
-            if ( r.z() > len_half.z())
-                r.z() -= len.z();
-            else if ( r.z() < -len_half.z())
-                r.z() += len.z();
+            r.array() -= len.array() * anint(r.array() * len_inv.array());
             return r;
         }
 
         inline void boundary( Point &a ) const override
         {
-            if ( std::abs(a.x()) > len_half.x())
-                a.x() -= len.x() * anint(a.x() * len_inv.x());
-            if ( std::abs(a.y()) > len_half.y())
-                a.y() -= len.y() * anint(a.y() * len_inv.y());
-            if ( std::abs(a.z()) > len_half.z())
-                a.z() -= len.z() * anint(a.z() * len_inv.z());
+            a.array() -= len.array() * anint(a.array() * len_inv.array());
         }
 
         void scale( Point &, Point &, const double, const double ) const override;
@@ -267,6 +278,49 @@ namespace Faunus
         Cuboid inscribe() const override;
     };
 
+    /**
+     * @brief Cubic box with periodic boundaries
+     *
+     * Same input as for `Cuboid`, but all sidelengths must be equal and
+     * only isotropic (`XYZ`) scaling is allowed; `setlen()` throws for
+     * unequal sidelengths, e.g. from anisotropic volume moves. Minimum image and
+     * boundary conditions use a single scalar length and, as the class
+     * is `final`, calls through pointers and references to `Cube` are
+     * resolved at compile time and inlined.
+     */
+    class Cube final : public Cuboid
+    {
+    public:
+        Cube();
+        Cube( Tmjson & );
+
+        void setlen( const Point & ) override; //!< Reset sidelengths; all must be equal
+
+        inline double sqdist( const Point &a, const Point &b ) const override
+        {
+            const double l = len.x(), l_inv = len_inv.x();
+            double dx = a.x() - b.x();
+            double dy = a.y() - b.y();
+            double dz = a.z() - b.z();
+            dx -= l * anint(dx * l_inv);
+            dy -= l * anint(dy * l_inv);
+            dz -= l * anint(dz * l_inv);
+            return dx * dx + dy * dy + dz * dz;
+        }
+
+        inline Point vdist( const Point &a, const Point &b ) override
+        {
+            Point r = a - b;
+            boundary(r);
+            return r;
+        }
+
+        inline void boundary( Point &a ) const override
+        {
+            a.array() -= len.x() * anint(a.array() * len_inv.x());
+        }
+    };
+
     /**
      * @brief Cuboid with no periodic boundaries in z direction
      *
@@ -275,7 +329,7 @@ namespace Faunus
      * @author Chris Evers
      * @date Lund, nov 2010
      */
-    class Cuboidslit : public Cuboid
+    class Cuboidslit final : public Cuboid
     {
     public:
         Cuboidslit();
@@ -283,41 +337,31 @@ namespace Faunus
 
         inline double sqdist( const Point &a, const Point &b ) const override
         {
-            double dx = std::abs(a.x() - b.x());
-            double dy = std::abs(a.y() - b.y());
+            double dx = a.x() - b.x();
+            double dy = a.y() - b.y();
             double dz = a.z() - b.z();
-            if ( dx > len_half.x())
-                dx -= len.x();
-            if ( dy > len_half.y())
-                dy -= len.y();
+            dx -= len.x() * anint(dx * len_inv.x());
+            dy -= len.y() * anint(dy * len_inv.y());
             return dx * dx + dy * dy + dz * dz;
         }
 
         inline Point vdist( const Point &a, const Point &b ) override
         {
             Point r(a - b);
-            if ( r.x() > len_half.x())
-                r.x() -= len.x();
-            else if ( r.x() < -len_half.x())
-                r.x() += len.x();
-            if ( r.y() > len_half.y())
-                r.y() -= len.y();
-            else if ( r.y() < -len_half.y())
-                r.y() += len.y();
+            r.x() -= len.x() * anint(r.x() * len_inv.x());
+            r.y() -= len.y() * anint(r.y() * len_inv.y());
             return r;
         }
 
         inline void boundary( Point &a ) const override
         {
-            if ( std::abs(a.x()) > len_half.x())
-                a.x() -= len.x() * anint(a.x() * len_inv.x());
-            if ( std::abs(a.y()) > len_half.y())
-                a.y() -= len.y() * anint(a.y() * len_inv.y());
+            a.x() -= len.x() * anint(a.x() * len_inv.x());
+            a.y() -= len.y() * anint(a.y() * len_inv.y());
         }
     };
 
     /** @brief Cuboid with no periodic boundaries (hard box) */
-    struct CuboidNoPBC : public Cuboid
+    struct CuboidNoPBC final : public Cuboid
     {
         CuboidNoPBC();
         CuboidNoPBC( Tmjson & );
@@ -379,7 +423,7 @@ namespace Faunus
     /**
      * @brief Cylinder with periodic boundaries in the z direction
      */
-    class PeriodicCylinder : public Cylinder
+    class PeriodicCylinder final : public Cylinder
     {
 
     public:
@@ -631,6 +675,123 @@ namespace Faunus
         }
     };
 
+    /**
+     * @brief Cell list for neighbour searches in a `Cuboid`
+     *
+     * Points with an integer id are binned into cells with side lengths of
+     * at least `cellsize`. `forNeighbours()` visits the ids in all cells that
+     * overlap with a sphere around a point, i.e. a superset of the ids within
+     * that distance. Ids can be inserted, moved and removed in constant time.
+     */
+    class CellList
+    {
+    private:
+        Point len, h;                           // box and cell side lengths
+        int n[3];                               // number of cells in each direction
+        double cellsize;                        // minimum cell side length
+        std::vector<std::vector<int>> cells;    // ids in each cell
+        std::vector<int> cellOf, slot;          // cell of each id (-1 if absent) and position therein
+
+        int index( int i, int j, int k ) const
+        {
+            i = (i % n[0] + n[0]) % n[0];
+            j = (j % n[1] + n[1]) % n[1];
+            k = (k % n[2] + n[2]) % n[2];
+            return i + n[0] * (j + n[1] * k);
+        }
+
+        int coord( const Point &a, int d ) const
+        {
+            return int(std::floor((a[d] + 0.5 * len[d]) / h[d]));
+        }
+
+    public:
+        CellList( double cellsize = 1 ) : cellsize(cellsize)
+        {
+            reset(Point(1, 1, 1));
+        }
+
+        /** @brief Remove all ids and set box side lengths */
+        void reset( const Point &boxlen )
+        {
+            len = boxlen;
+            for ( int d = 0; d < 3; d++ )
+            {
+                n[d] = std::max(1, int(len[d] / cellsize));
+                h[d] = len[d] / n[d];
+            }
+            cells.assign(n[0] * n[1] * n[2], std::vector<int>());
+            cellOf.clear();
+            slot.clear();
+        }
+
+        /** @brief Set minimum cell side length and clear list */
+        void setCellSize( double size )
+        {
+            cellsize = size;
+            reset(len);
+        }
+
+        const Point &boxlen() const { return len; }
+
+        bool exists( int id ) const { return id < (int) cellOf.size() && cellOf[id] >= 0; }
+
+        void insert( int id, const Point &a )
+        {
+            assert(!exists(id));
+            if ( id >= (int) cellOf.size())
+            {
+                cellOf.resize(id + 1, -1);
+                slot.resize(id + 1, -1);
+            }
+            int c = index(coord(a, 0), coord(a, 1), coord(a, 2));
+            cellOf[id] = c;
+            slot[id] = cells[c].size();
+            cells[c].push_back(id);
+        }
+
+        void erase( int id )
+        {
+            assert(exists(id));
+            auto &v = cells[cellOf[id]];
+            v[slot[id]] = v.back();
+            slot[v.back()] = slot[id];
+            v.pop_back();
+            cellOf[id] = slot[id] = -1;
+        }
+
+        /** @brief Update position of `id` */
+        void move( int id, const Point &a )
+        {
+            if ( exists(id))
+                if ( cellOf[id] == index(coord(a, 0), coord(a, 1), coord(a, 2)))
+                    return;
+            if ( exists(id))
+                erase(id);
+            insert(id, a);
+        }
+
+        /** @brief Call `f(id)` for ids in cells closer than `r` to `a` (superset) */
+        template<class Tfunc>
+        void forNeighbours( const Point &a, double r, Tfunc f ) const
+        {
+            int lo[3], hi[3];
+            for ( int d = 0; d < 3; d++ )
+            {
+                double rd = std::min(r, 0.5 * len[d]); // also guards against infinite `r`
+                lo[d] = int(std::floor((a[d] + 0.5 * len[d] - rd) / h[d]));
+                hi[d] = int(std::floor((a[d] + 0.5 * len[d] + rd) / h[d]));
+                if ( hi[d] - lo[d] >= n[d] )
+                    hi[d] = lo[d] + n[d] - 1; // visit each cell only once
+            }
+            for ( int k = lo[2]; k <= hi[2]; k++ )
+                for ( int j = lo[1]; j <= hi[1]; j++ )
+                    for ( int i = lo[0]; i <= hi[0]; i++ )
+                        for ( auto id : cells[index(i, j, k)] )
+                            f(id);
+        }
+    };
+
     /**
      * @brief Find an empty space for a particle vector in a space of other particles
      * @author Mikael Lund
@@ -670,11 +670,136 @@ namespace Faunus {
       rvec *x_xtc;        //!< vector of particle coordinates
       float time_xtc, prec_xtc;
       int natoms_xtc, step_xtc;
+      std::string filename;           //!< name of currently opened file
+      std::vector<long long> offsets; //!< byte offset of each frame (see `buildindex()`)
+
+      /** @brief Read big-endian (xdr) integer from stream */
+      static bool readxdrint( std::istream &f, int &i )
+      {
+          unsigned char b[4];
+          if ( !f.read((char *) b, 4))
+              return false;
+          i = int((unsigned(b[0]) << 24) | (unsigned(b[1]) << 16) | (unsigned(b[2]) << 8) | unsigned(b[3]));
+          return true;
+      }
+
     public:
       std::vector<Group*> g;          //!< List of PBC groups to be saved as whole
 
       inline int getNumAtoms() { return natoms_xtc; }
 
+      /** @brief Number of indexed frames (zero if `buildindex()` has not been called) */
+      inline size_t numFrames() const { return offsets.size(); }
+
+      /**
+       * @brief Build frame index of the opened file
+       *
+       * Scans all frame headers and stores the byte offset of each
+       * frame so that arbitrary frames can later be accessed with `seek()`.
+       * Coordinates are *not* decompressed during the scan -- only the
+       * header and the size of the compressed block is read, each followed
+       * by a jump to the next frame. If `cache=true`, the index is
+       * saved to and loaded from `<file>.idx` (next to the trajectory)
+       * which is reused as long as the trajectory size is unchanged.
+       * No file is written by default.
+       *
+       * @returns Number of frames found
+       */
+      size_t buildindex( bool cache = false )
+      {
+          offsets.clear();
+          if ( xd == NULL )
+              throw std::runtime_error("xtc file must be opened before indexing");
+
+          std::ifstream f(filename, std::ios::binary);
+          f.seekg(0, std::ios::end);
+          long long filesize = f.tellg();
+          string idxfile = filename + ".idx";
+
+          if ( cache )
+          {
+              std::ifstream in(idxfile);
+              long long size, n;
+              int natoms;
+              if ( in >> size >> natoms >> n )
+                  if ( size == filesize && natoms == natoms_xtc )
+                  {
+                      offsets.resize(n);
+                      for ( auto &i : offsets )
+                          in >> i;
+                      if ( in )
+                          return offsets.size();
+                      offsets.clear();
+                  }
+          }
+
+          // xtc frame: magic, natoms, step, time, box[9], natoms -> 56 bytes,
+          // followed by either plain coordinates (natoms<=9) or a compressed
+          // block preceded by precision, min/max integers, smallidx and byte count
+          long long pos = 0;
+          int magic, natoms, nbytes;
+          f.clear();
+          f.seekg(0);
+          while ( pos < filesize )
+          {
+              if ( !readxdrint(f, magic) || !readxdrint(f, natoms) )
+                  break;
+              if ( magic != 1995 || natoms != natoms_xtc )
+                  throw std::runtime_error("corrupt xtc frame at byte " + std::to_string(pos));
+              if ( natoms <= 9 )
+                  f.seekg(pos + 56 + 12 * natoms);
+              else
+              {
+                  f.seekg(pos + 88);
+                  if ( !readxdrint(f, nbytes) )
+                      break;
+                  f.seekg(pos + 92 + ((nbytes + 3) & ~3));
+              }
+              if ( !f )
+                  break;
+              offsets.push_back(pos);
+              pos = f.tellg();
+          }
+
+          if ( cache )
+          {
+              std::ofstream out(idxfile);
+              if ( out )
+              {
+                  out << filesize << " " << natoms_xtc << " " << offsets.size() << "\n";
+                  for ( auto i : offsets )
+                      out << i << "\n";
+              }
+          }
+          return offsets.size();
+      }
+
+      /** @brief Frame index as byte offsets into file */
+      inline const std::vector<long long> &getindex() const { return offsets; }
+
+      /** @brief Set frame index, e.g. from another instance opened on the same file */
+      inline void setindex( const std::vector<long long> &v ) { offsets = v; }
+
+      /**
+       * @brief Position file at frame `n` so that the next `loadnextframe()` reads it
+       * @note Requires that `buildindex()` has been called
+       */
+      bool seek( size_t n )
+      {
+          if ( xd != NULL && n < offsets.size())
+              return xdrfile_seek(xd, offsets[n], SEEK_SET) == exdrOK;
+          return false;
+      }
+
+      /** @brief Load frame number `n` into Space -- see `loadnextframe()` */
+      template<class Tspace>
+      bool loadframe( size_t n, Tspace &c, bool setbox = true, bool applypbc = false )
+      {
+          if ( seek(n))
+              return loadnextframe(c, setbox, applypbc);
+          return false;
+      }
+
       /**
        * @brief Load a single frame into cuboid
        *
@@ -713,9 +838,9 @@ namespace Faunus {
                               c.p[i] = c.p[i] - geo->len_half;
                               if (applypbc)
                                   geo->boundary( c.p[i] );
-                              c.trial[i] = Point(c.p[i]);
-                              if ( geo->collision(c.p[i], 0) )
+                              else if ( geo->collision(c.p[i], 0) )
                                   throw std::runtime_error("particle-container collision");
+                              c.trial[i] = Point(c.p[i]);
                           } 
                           return true;
                       }
@@ -771,6 +896,8 @@ namespace Faunus {
       inline bool open(std::string s) {
         if (xd!=NULL)
           close();
+        offsets.clear();
+        filename = s;
         xd = xdrfile_open(&s[0], "r");
         if (xd!=NULL) {
           int rc = read_xtc_natoms(&s[0], &natoms_xtc); // get number of atoms
@@ -787,6 +914,7 @@ namespace Faunus {
         xdrfile_close(xd);
         xd=NULL;
         delete[] x_xtc;
+        x_xtc=NULL;
       }
 
       FormatXTC(double len) {
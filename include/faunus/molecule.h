@@ -111,6 +111,317 @@ namespace Faunus
       }
   };
 
+  /**
+   * @brief Spatial hash for hard sphere overlap checks
+   *
+   * Particles are binned into cells at least as wide as the largest
+   * contact distance so that an overlap check only needs to visit the
+   * 27 surrounding cells, i.e. O(1) expected time. The cells span the
+   * cuboid inscribing the container (see `Geometrybase::inscribe()`) and
+   * wrap around at the edges whereby periodic boundaries are handled by
+   * the distance function of the geometry.
+   */
+  class OverlapGrid
+  {
+  private:
+      Geometry::Geometrybase &geo;
+      Point half;                    // half box length
+      Point cell_inv;                // inverse cell length
+      Eigen::Vector3i n;             // number of cells in each direction
+      std::vector<int> head, next;   // linked cell list
+      std::vector<Point> pos;        // stored positions
+      std::vector<double> radius;    // stored radii
+      std::vector<int> nb[3];        // distinct neighbour cell offsets
+
+      int cell( const Point &a, int k ) const
+      {
+          int i = int(std::floor((a[k] + half[k]) * cell_inv[k]));
+          return std::min(std::max(i, 0), n[k] - 1);
+      }
+
+  public:
+      /**
+       * @param g Geometry used for distance calculations
+       * @param width Minimum cell width, i.e. the largest contact distance
+       */
+      OverlapGrid( Geometry::Geometrybase &g, double width ) : geo(g)
+      {
+          Point len = geo.inscribe().len;
+          for ( int k = 0; k < 3; k++ )
+          {
+              n[k] = (width > 0) ? int(std::min(len[k] / width, 128.0)) : 1; // cap memory
+              n[k] = std::max(n[k], 1);
+              half[k] = 0.5 * len[k];
+              cell_inv[k] = n[k] / len[k];
+              nb[k] = {0};
+              if ( n[k] > 1 )
+                  nb[k].push_back(1);
+              if ( n[k] > 2 )
+                  nb[k].push_back(-1);
+          }
+          head.assign(n.prod(), -1);
+      }
+
+      /** @brief Add particle to grid */
+      void add( const Point &a, double r )
+      {
+          int c = cell(a, 0) + n[0] * (cell(a, 1) + n[1] * cell(a, 2));
+          next.push_back(head[c]);
+          head[c] = int(pos.size());
+          pos.push_back(a);
+          radius.push_back(r);
+      }
+
+      /** @brief True if sphere at `a` with radius `r` overlaps with any stored particle */
+      bool overlap( const Point &a, double r ) const
+      {
+          int c[3] = {cell(a, 0), cell(a, 1), cell(a, 2)};
+          for ( int dz : nb[2] )
+              for ( int dy : nb[1] )
+                  for ( int dx : nb[0] )
+                  {
+                      int x = (c[0] + dx + n[0]) % n[0];
+                      int y = (c[1] + dy + n[1]) % n[1];
+                      int z = (c[2] + dz + n[2]) % n[2];
+                      for ( int j = head[x + n[0] * (y + n[1] * z)]; j >= 0; j = next[j] )
+                      {
+                          double s = r + radius[j];
+                          if ( geo.sqdist(a, pos[j]) < s * s )
+                              return true;
+                      }
+                  }
+          return false;
+      }
+
+      size_t size() const { return pos.size(); } //!< Number of stored particles
+  };
+
+  /**
+   * @brief Insert many molecules at once without particle overlap
+   *
+   * Where `RandomInserter` generates one molecule at a time and only
+   * checks for container overlap, this inserter places `N` molecules
+   * in one go and additionally rejects hard sphere overlap with
+   * already present particles as well as with the molecules placed so far.
+   * Overlap checks use an `OverlapGrid` and are O(1) so that dense
+   * systems with many particles can be set up quickly. Atomic species are
+   * placed atom by atom while molecules are placed as rigid bodies.
+   * Two methods are available:
+   *
+   * - `RSA`: random sequential addition. Each molecule is given up to
+   *   `maxtrials` random positions. The jamming limit of hard spheres
+   *   is a packing fraction of about 0.38.
+   * - `LATTICE`: molecules are placed on randomly picked sites of a
+   *   face centered cubic lattice with one site per molecule. Rejected
+   *   molecules are retried on shifted and successively finer lattices.
+   *   Monodisperse spheres can be packed to a packing fraction of 0.65
+   *   and beyond if the container is commensurate with the lattice.
+   *
+   * In both cases the largest molecules are placed first.
+   */
+  template<typename Tpvec>
+  struct BulkInserter
+  {
+      enum class Method { NONE, RSA, LATTICE };
+      Method method;     //!< Insertion method. Default: `NONE`
+      Point dir;         //!< Scalars for random mass center position. Default (1,1,1)
+      Point offset;      //!< Added to random position. Default (0,0,0)
+      bool rotate;       //!< Set to true to randomly rotate molecule when inserted. Default: true
+      int maxtrials;     //!< Maximum number of trial positions per molecule (`RSA`)
+
+      BulkInserter() : method(Method::NONE), dir(1, 1, 1), offset(0, 0, 0), rotate(true), maxtrials(1e5) {}
+
+      /** @brief Parse method from string: `rsa`, `lattice` or `none` */
+      void setMethod( const string &s )
+      {
+          if ( s == "rsa" )
+              method = Method::RSA;
+          else if ( s == "lattice" )
+              method = Method::LATTICE;
+          else if ( s.empty() || s == "none" )
+              method = Method::NONE;
+          else
+              throw std::runtime_error("Unknown bulk insertion method '" + s + "'");
+      }
+
+  private:
+      /**
+       * @brief Face centered cubic lattice in random order
+       * @param geo Geometry
+       * @param b Max. length of cubic unit cell, each holding four sites
+       * @param shift Translation of all sites
+       */
+      std::vector<Point> lattice( Geometry::Geometrybase &geo, double b, const Point &shift ) const
+      {
+          static const double basis[4][3] = {{0, 0, 0}, {0.5, 0.5, 0}, {0.5, 0, 0.5}, {0, 0.5, 0.5}};
+          Point len = geo.inscribe().len.cwiseProduct(dir.cwiseAbs());
+          Eigen::Vector3i n;
+          Point c;  // cell length, adjusted to fit an integer number of cells
+          for ( int k = 0; k < 3; k++ )
+          {
+              n[k] = std::max(int(std::ceil(len[k] / b)), 1);
+              c[k] = len[k] / n[k];
+          }
+          std::vector<Point> sites;
+          sites.reserve(4 * n.prod());
+          for ( int i = 0; i < n.x(); i++ )
+              for ( int j = 0; j < n.y(); j++ )
+                  for ( int k = 0; k < n.z(); k++ )
+                      for ( auto &u : basis )
+                      {
+                          Point s((i + u[0] - 0.5 * n.x()) * c.x(), (j + u[1] - 0.5 * n.y()) * c.y(),
+                                  (k + u[2] - 0.5 * n.z()) * c.z());
+                          for ( int d = 0; d < 3; d++ )
+                              if ( len[d] == 0 ) // collapse directions excluded by `dir`
+                                  s[d] = 0;
+                          s += shift + offset;
+                          geo.boundary(s);
+                          sites.push_back(s);
+                      }
+          std::shuffle(sites.begin(), sites.end(), slump.eng);
+          return sites;
+      }
+
+      /** @brief Try to place `v` at `a`; if successful `v` is updated and added to grid */
+      bool place( Geometry::Geometrybase &geo, OverlapGrid &grid, Tpvec &v, const Point &a ) const
+      {
+          Geometry::QuaternionRotate rot;
+          Point u;
+          if ( v.size() == 1 )
+          {   // atom: check position before rotating internal coordinates
+              auto &i = v.front();
+              if ( geo.collision(a, i.radius) || grid.overlap(a, i.radius))
+                  return false;
+              if ( rotate )
+              {
+                  u.ranunit(slump);
+                  rot.setAxis(geo, {0, 0, 0}, u, 2 * pc::pi * slump());
+                  i.rotate(rot);
+              }
+              i = a;
+              grid.add(i, i.radius);
+              return true;
+          }
+          Tpvec t = v;
+          if ( rotate )
+          {
+              u.ranunit(slump);
+              rot.setAxis(geo, {0, 0, 0}, u, 2 * pc::pi * slump());
+          }
+          for ( auto &i : t )
+          {
+              if ( rotate )
+                  i = rot(i) + a;
+              else
+                  i += a;
+              geo.boundary(i);
+              if ( geo.collision(i, i.radius) || grid.overlap(i, i.radius))
+                  return false;
+          }
+          for ( auto &i : t )
+              grid.add(i, i.radius);
+          v = t;
+          return true;
+      }
+
+  public:
+      /**
+       * @brief Generate `N` molecules
+       * @param geo Geometry
+       * @param p Particles already in the container, typically `spc.p`
+       * @param mol Molecule to insert
+       * @param N Number of molecules to generate
+       */
+      template<class TMoleculeData>
+      std::vector<Tpvec> operator()( Geometry::Geometrybase &geo, const Tpvec &p, TMoleculeData &mol, int N ) const
+      {
+          std::vector<Tpvec> out(std::max(N, 0));
+          std::vector<Tpvec> units; // placed independently
+          double rmax = 0;
+          for ( auto &i : p )
+              rmax = std::max(rmax, double(i.radius));
+          for ( auto &v : out )
+          {
+              v = mol.getRandomConformation();
+              for ( auto &i : v )
+                  rmax = std::max(rmax, double(i.radius));
+              if ( mol.isAtomic())
+                  for ( auto &i : v )
+                      units.push_back(Tpvec(1, i));
+              else
+              {
+                  Geometry::cm2origo(geo, v);
+                  units.push_back(v);
+              }
+          }
+
+          OverlapGrid grid(geo, 2 * rmax);
+          for ( auto &i : p )
+              grid.add(i, i.radius);
+
+          // place largest units first
+          std::vector<double> size(units.size(), 0);
+          for ( size_t k = 0; k < units.size(); k++ )
+              for ( auto &i : units[k] )
+                  size[k] = std::max(size[k], i.norm() + i.radius);
+          std::vector<size_t> order(units.size());
+          std::iota(order.begin(), order.end(), 0);
+          std::stable_sort(order.begin(), order.end(), [&]( size_t i, size_t j ) { return size[i] > size[j]; });
+
+          if ( method == Method::LATTICE )
+          {
+              Point len = geo.inscribe().len.cwiseProduct(dir.cwiseAbs());
+              double V = 1;
+              int d = 0;
+              for ( int k = 0; k < 3; k++ )
+                  if ( len[k] > 0 )
+                  {
+                      V *= len[k];
+                      d++;
+                  }
+              // unit cell length so that there is a site for each unit
+              double b0 = std::pow(4 * V / std::max(units.size(), size_t(1)), 1.0 / std::max(d, 1));
+              double b = b0;
+              Point shift(0, 0, 0);
+              size_t cnt = 0;
+              for ( int pass = 0; cnt < units.size(); pass++ )
+              {
+                  if ( pass > 100 )
+                      throw std::runtime_error("Lattice insertion of '" + mol.name + "' failed. Packing too dense?");
+                  for ( auto &s : lattice(geo, b, shift))
+                      if ( cnt < units.size())
+                          cnt += place(geo, grid, units[order[cnt]], s);
+                  shift = Point(slump(), slump(), slump()) * b; // rejected units try shifted
+                  b = std::max(0.97 * b, 0.6 * b0);             // ...and finer lattices
+              }
+          }
+          else
+              for ( auto k : order )
+              {
+                  Point a;
+                  int cnt = 0;
+                  do
+                  {
+                      if ( cnt++ > maxtrials )
+                          throw std::runtime_error("Max. # of overlap checks reached upon insertion.");
+                      geo.randompos(a);
+                      a = a.cwiseProduct(dir) + offset;
+                      geo.boundary(a);
+                  }
+                  while ( !place(geo, grid, units[k], a));
+              }
+
+          auto u = units.begin();
+          for ( auto &v : out )
+              if ( mol.isAtomic())
+                  for ( auto &i : v )
+                      i = (*u++).front();
+              else
+                  v = *u++;
+          return out;
+      }
+  };
+
   /**
    * @brief Weight molecule according to deviation from mean charge
    *
@@ -150,12 +461,14 @@ namespace Faunus
    * `activity`    | float   | Chemical activity for grand canonical MC [mol/l]
    * `atoms`       | string  | List of atoms in molecule (use `AtomData` names)
    * `atomic`      | bool    | `true` if molecule a free atomic species (default: false)
+   * `bulkinsert`  | string  | Insert all `Ninit` molecules w. particle overlap check: `rsa` or `lattice` (see `BulkInserter`)
    * `bonds`       | string  | List of harmonic bonds - index 0 corresponds to first atom in structure
    * `dihedrals`   | string  | List of dihedrals (under construction!)
    * `fasta`       | string  | Construct bonded chain from fasta sequence (hardcoded k and req)
    * `insdir`      | string  | Directions for generation of random position. Default: "1 1 1" = XYZ
    * `insoffset`   | string  | Translate generated random position. Default: "0 0 0" = no translation
    * `keeppos`     | bool    | Keep original positions (`insdir`, `insoffset` ignored. Default: `false`)
+   * `maxtrials`   | int     | Max. insertion attempts per molecule. Default: 2000, or 1e5 with `bulkinsert`
    * `Ninit`       | int     | Initial number of molecules to be inserted into the simulation container
    * `checkoverlap`| bool    | Check for overlap while inserting. Default: true
    * `rotate`      | bool    | Randomly rotate molecule or anisotropic atom upon insertion. Default: true
@@ -197,6 +510,7 @@ namespace Faunus
 
   public:
       TinserterFunc inserterFunctor;              //!< Function for insertion into space
+      BulkInserter<Tpvec> bulkInserter;           //!< Used for initial insertion if `method!=NONE`
 
       int getConformationIndex() const
       {
@@ -214,7 +528,14 @@ namespace Faunus
           ins.checkOverlap = molecule.value()["checkoverlap"] | true;
           ins.rotate = molecule.value()["rotate"] | true;
           ins.keeppos = molecule.value()["keeppos"] | false;
+          ins.maxtrials = molecule.value()["maxtrials"] | ins.maxtrials;
           setInserter(ins);
+          bulkInserter.dir = ins.dir;
+          bulkInserter.offset = ins.offset;
+          bulkInserter.rotate = ins.rotate;
+          bulkInserter.maxtrials = molecule.value()["maxtrials"] | bulkInserter.maxtrials;
+          if ( !ins.keeppos )
+              bulkInserter.setMethod(molecule.value().value("bulkinsert", string()));
       }
 
       /** @brief Get list of bonds for molecule */
@@ -266,6 +587,27 @@ namespace Faunus
           return inserterFunctor(geo, otherparticles, *this);
       }
 
+      /**
+       * @brief Get `N` random conformations that fit in container
+       *
+       * If a bulk insertion method is set (JSON keyword `bulkinsert`),
+       * all molecules are placed at once by `BulkInserter`, avoiding overlap
+       * with `otherparticles` and with each other. Otherwise the
+       * inserter function is called `N` times, each time seeing only
+       * `otherparticles`; to respect previously inserted molecules, call
+       * `getRandomConformation()` after each insertion instead.
+       */
+      std::vector<Tpvec> getRandomConformations(
+          Geometry::Geometrybase &geo, const Tpvec &otherparticles, int N )
+      {
+          if ( bulkInserter.method != BulkInserter<Tpvec>::Method::NONE )
+              return bulkInserter(geo, otherparticles, *this, N);
+          std::vector<Tpvec> v;
+          while ( N-- > 0 )
+              v.push_back(getRandomConformation(geo, otherparticles));
+          return v;
+      }
+
       /**
        * @brief Store a single conformation
        * @param vec Vector of particles
@@ -12,6 +12,7 @@
 #include <faunus/energy.h>
 #include <faunus/textio.h>
 #include <faunus/json.h>
+#include <faunus/profiler.h>
 #include <faunus/titrate.h>
 
 #ifdef ENABLE_MPI
@@ -107,6 +108,30 @@
          * translation -- polarisation is updated only after all moves have
          * been carried out.
          *
+         * The self-consistent moments,
+         * \f$ \boldsymbol{\mu}_i = \boldsymbol{\alpha}_i\boldsymbol{E}_i + \boldsymbol{\mu}_{p,i} \f$,
+         * are found by plain fixed-point iteration or with DIIS (Pulay)
+         * acceleration which usually needs fewer field evaluations.
+         * Only moments with a residual above the threshold are updated in each
+         * iteration. The field of the last configuration is kept and only
+         * contributions involving particles with a new position or moment are
+         * re-evaluated; if more than half the particles changed, the full field
+         * is calculated.
+         * For moves that displace all particles, the initial guess may be
+         * extrapolated from previous induced moments using the always stable
+         * predictor-corrector (ASPC) coefficients of Kolafa,
+         * [doi:10/b2ztbf](http://dx.doi.org/10.1002/jcc.10385).
+         * The system energy of the current configuration is cached so that
+         * only the trial configuration needs a full energy evaluation.
+         *
+         * Keyword          | Description
+         * :--------------- | :--------------------------------------------------------
+         * `pol_threshold`  | Convergence threshold for induced moments (default: 0.001)
+         * `max_iterations` | Maximum number of iterations (default: 40)
+         * `pol_solver`     | `iterative` or `diis` (default: `iterative`)
+         * `pol_diis`       | Number of stored DIIS vectors (default: 6)
+         * `pol_aspc`       | Order of initial guess extrapolation; -1 disables (default: -1)
+         *
          * @note Will currently not work for Grand Caninical moves
          */
         template<class Tmove>
@@ -115,46 +140,185 @@
         private:
             using Tmove::spc;
             using Tmove::pot;
+            typedef typename std::remove_pointer<decltype(spc)>::type::ParticleVector Tpvec;
+            typedef typename Tpvec::value_type Tparticle;
+
             int Ntrials;                    // Number of repeats within move
             int max_iter;                   // max numbr of iterations
             double threshold;          // threshold for iteration
             bool updateDip;                 // true if ind. dipoles should be updated
             Eigen::MatrixXd field;      // field on each particle
+            Eigen::MatrixXd fieldacc;       // field of last accepted configuration
             Average<int> numIter;           // average number of iterations per move
 
+            string solver;                  // "iterative" or "diis"
+            int diis_size;                  // max. number of DIIS vectors
+            int aspc;                       // extrapolation order (-1 = off)
+            vector<double> aspcB;           // extrapolation coefficients
+            vector<Eigen::MatrixXd> history;// converged induced moments, newest first
+            Tpvec fieldref, fieldrefacc;    // configurations that `field` and `fieldacc` correspond to
+            int fieldcnt;                   // incremental field updates since full evaluation
+            Average<double> fieldinc;       // percentage of incremental field updates
+            Tpvec snapshot;                 // `spc->p` after last call to move()
+            double uref, utrial, dusub;     // energy of `spc->p`, trial and repeated move
+            bool uvalid;                    // true if `uref` is up to date
+
+            /** @brief True if particles differ in position, charge or dipole moment */
+            static bool differs( const Tparticle &a, const Tparticle &b )
+            {
+                return static_cast<const Point &>(a) != static_cast<const Point &>(b)
+                    || a.charge != b.charge || a.muscalar() != b.muscalar() || a.mu() != b.mu();
+            }
+
+            static void setMoment( Tparticle &a, const Point &mu )
+            {
+                a.muscalar() = mu.norm();
+                if ( a.muscalar() > 1e-6 )
+                    a.mu() = mu / a.muscalar();
+            }
+
+            /**
+             * @brief Bring `field` up to date with `p`
+             *
+             * Contributions involving particles that differ from `fieldref` are
+             * subtracted and added back for the new configuration.
+             */
+            void updateField( const Tpvec &p )
+            {
+                const int N = p.size();
+                if ( (int) fieldref.size() == N && fieldcnt < 100 )
+                {
+                    std::vector<int> index;
+                    for ( int i = 0; i < N; i++ )
+                        if ( differs(p[i], fieldref[i]))
+                            index.push_back(i);
+                    if ( 2 * (int) index.size() < N )
+                    {
+                        if ( !index.empty())
+                        {
+                            field = -field;
+                            pot->field(fieldref, field, index);
+                            field = -field;
+                            pot->field(p, field, index);
+                            for ( auto i : index )
+                                fieldref[i] = p[i];
+                            fieldcnt++;
+                        }
+                        fieldinc += 100;
+                        return;
+                    }
+                }
+                field.setZero(3, N);
+                pot->field(p, field);
+                fieldref = p;
+                fieldcnt = 0;
+                fieldinc += 0;
+            }
+
+            /** @brief Initial guess extrapolated from previously converged induced moments */
+            void extrapolate( Tpvec &p )
+            {
+                if ( aspc < 0 || history.size() < aspcB.size())
+                    return;
+                for ( size_t i = 0; i < p.size(); i++ )
+                {
+                    Point mu = p[i].mup();
+                    for ( size_t j = 0; j < aspcB.size(); j++ )
+                        mu += aspcB[j] * history[j].col(i);
+                    setMoment(p[i], mu);
+                }
+            }
+
+            /** @brief Store induced moments of the current configuration for extrapolation */
+            void record()
+            {
+                if ( aspc < 0 )
+                    return;
+                const auto &p = spc->p;
+                if ( !history.empty() && history.front().cols() != (int) p.size())
+                    history.clear();
+                Eigen::MatrixXd mu(3, p.size());
+                for ( size_t i = 0; i < p.size(); i++ )
+                    mu.col(i) = p[i].mu() * p[i].muscalar() - p[i].mup();
+                history.insert(history.begin(), mu);
+                if ( history.size() > aspcB.size())
+                    history.pop_back();
+            }
+
+            /**
+             * @brief DIIS (Pulay) step
+             *
+             * Replaces `g` with the linear combination of stored iterates that
+             * minimises the norm of the combined residual, `g-mu`.
+             */
+            void diis( vector<Eigen::VectorXd> &G, vector<Eigen::VectorXd> &R, Eigen::MatrixXd &g,
+                       const Eigen::MatrixXd &mu )
+            {
+                G.push_back(Eigen::Map<const Eigen::VectorXd>(g.data(), g.size()));
+                R.push_back(G.back() - Eigen::Map<const Eigen::VectorXd>(mu.data(), mu.size()));
+                if ( (int) G.size() > diis_size )
+                {
+                    G.erase(G.begin());
+                    R.erase(R.begin());
+                }
+                const int m = G.size();
+                if ( m < 2 )
+                    return;
+                Eigen::MatrixXd B(m + 1, m + 1);
+                for ( int i = 0; i < m; i++ )
+                    for ( int j = 0; j <= i; j++ )
+                        B(i, j) = B(j, i) = R[i].dot(R[j]);
+                double s = B.topLeftCorner(m, m).diagonal().maxCoeff();
+                if ( s > 0 )
+                    B.topLeftCorner(m, m) /= s;
+                B.row(m).setOnes();
+                B.col(m).setOnes();
+                B(m, m) = 0;
+                Eigen::VectorXd rhs = Eigen::VectorXd::Zero(m + 1);
+                rhs(m) = 1;
+                Eigen::VectorXd c = B.fullPivLu().solve(rhs);
+                if ( !c.allFinite())
+                    return;
+                Eigen::Map<Eigen::VectorXd> x(g.data(), g.size());
+                x.setZero();
+                for ( int k = 0; k < m; k++ )
+                    x += c(k) * G[k];
+            }
+
             /**
                *  @brief Updates dipole moment w. permanent plus induced dipole moment
-               *  @param pot Hamiltonian
                *  @param p Particles to update
                */
-            template<typename Tenergy, typename Tparticles>
-            void induceDipoles( Tenergy &pot, Tparticles &p )
+            void induceDipoles( Tpvec &p )
             {
-
+                const int N = p.size();
+                Eigen::MatrixXd mu(3, N), g(3, N);
+                Eigen::VectorXd err(N);
+                vector<Eigen::VectorXd> G, R;
                 int cnt = 0;
-                Eigen::VectorXd mu_err_norm((int) p.size());
 
-                do
+                extrapolate(p);
+                while ( true )
                 {
                     cnt++;
-                    mu_err_norm.setZero();
-                    field.setZero();
-                    pot.field(p, field);
-                    for ( size_t i = 0; i < p.size(); i++ )
+                    updateField(p);
+                    for ( int i = 0; i < N; i++ )
                     {
-                        Point E = field.col(i);                  // field on i
-                        Point mu_trial = p[i].alpha() * E + p[i].mup();// new tot. dipole
-                        Point mu_err = mu_trial - p[i].mu() * p[i].muscalar();// mu difference
-                        mu_err_norm[i] = mu_err.norm();          // norm of previous row
-                        p[i].muscalar() = mu_trial.norm();         // update dip scalar in particle
-                        if ( p[i].muscalar() > 1e-6 )
-                            p[i].mu() = mu_trial / p[i].muscalar();      // update article dip.
+                        Point E = field.col(i);                                // field on i
+                        mu.col(i) = p[i].mu() * p[i].muscalar();                // previous dipole
+                        g.col(i) = p[i].alpha() * E + p[i].mup();               // new tot. dipole
+                        err[i] = (g.col(i) - mu.col(i)).norm();
                     }
+                    if ( err.maxCoeff() <= threshold ) // is threshold OK?
+                        break;
                     if ( cnt > max_iter )
                         throw std::runtime_error("Field induction reached maximum number of iterations.");
-
+                    if ( solver == "diis" )
+                        diis(G, R, g, mu);
+                    for ( int i = 0; i < N; i++ )
+                        if ( err[i] > threshold ) // converged moments are left untouched
+                            setMoment(p[i], g.col(i));
                 }
-                while ( mu_err_norm.maxCoeff() > threshold ); // is threshold OK?
 
                 numIter += cnt; // average number of iterations
             }
@@ -173,33 +337,49 @@
                 updateDip = (Ntrials == updateAt);
 
                 if ( updateDip )
-                {
-                    field.resize(3, spc->trial.size());
-                    induceDipoles(*pot, spc->trial);
-                }
+                    induceDipoles(spc->trial);
             }
 
             double _energyChange() override
             {
                 if ( updateDip )
-                    return Energy::systemEnergy(*spc, *pot, spc->trial)
-                        - Energy::systemEnergy(*spc, *pot, spc->p);
-                else
-                    return Tmove::_energyChange();
+                {
+                    if ( !uvalid )
+                        uref = Energy::systemEnergy(*spc, *pot, spc->p);
+                    uvalid = true;
+                    assert(std::fabs(uref - Energy::systemEnergy(*spc, *pot, spc->p)) < 1e-6 * (1 + std::fabs(uref)));
+                    utrial = Energy::systemEnergy(*spc, *pot, spc->trial);
+                    return utrial - uref;
+                }
+                dusub = Tmove::_energyChange();
+                return dusub;
             }
 
             void _rejectMove() override
             {
                 Tmove::_rejectMove();
                 if ( updateDip )
+                {
                     Tmove::spc->trial = Tmove::spc->p;
+                    field = fieldacc;
+                    fieldref = fieldrefacc;
+                    record();
+                }
             }
 
             void _acceptMove() override
             {
                 Tmove::_acceptMove();
                 if ( updateDip )
+                {
                     Tmove::spc->p = Tmove::spc->trial;
+                    fieldacc = field;
+                    fieldrefacc = fieldref;
+                    uref = utrial;
+                    record();
+                }
+                else
+                    uref += dusub;
             }
 
             string _info() override
@@ -208,12 +388,49 @@
                 using namespace textio;
                 o << pad(SUB, Tmove::w, "Polarisation updates") << numIter.cnt << "\n"
                   << pad(SUB, Tmove::w, "Polarisation threshold") << threshold << "\n"
-                  << pad(SUB, Tmove::w, "Polarisation iterations") << numIter.avg()
-                  << " (max. " << max_iter << ")" << "\n"
-                  << Tmove::_info();
+                  << pad(SUB, Tmove::w, "Polarisation solver") << solver;
+                if ( solver == "diis" )
+                    o << " (" << diis_size << " vectors)";
+                o << "\n";
+                if ( aspc >= 0 )
+                    o << pad(SUB, Tmove::w, "Polarisation extrapolation") << "ASPC order " << aspc << "\n";
+                o << pad(SUB, Tmove::w, "Polarisation iterations") << numIter.avg()
+                  << " (max. " << max_iter << ")" << "\n";
+                if ( fieldinc.cnt > 0 )
+                    o << pad(SUB, Tmove::w, "Incremental field updates") << fieldinc.avg() << percent << "\n";
+                o << Tmove::_info();
                 return o.str();
             }
 
+            void setup( Tmjson &j )
+            {
+                threshold = j.value("pol_threshold", 0.001);
+                max_iter = j.value("max_iterations", 40);
+                solver = j.value("pol_solver", string("iterative"));
+                diis_size = j.value("pol_diis", 6);
+                aspc = j.value("pol_aspc", -1);
+                fieldcnt = 0;
+                uvalid = false;
+
+                if ( solver != "iterative" && solver != "diis" )
+                    throw std::runtime_error("PolarizeMove: unknown solver '" + solver + "'");
+
+                // ASPC predictor coefficients for order k using the last k+2 steps
+                if ( aspc >= 0 )
+                {
+                    auto binomial = []( int n, int k ) {
+                        double b = 1;
+                        for ( int i = 1; i <= k; i++ )
+                            b = b * (n - k + i) / i;
+                        return b;
+                    };
+                    const int k = aspc;
+                    for ( int j = 1; j <= k + 2; j++ )
+                        aspcB.push_back((j % 2 ? 1 : -1) * j * binomial(2 * k + 4, k + 2 - j)
+                                            / binomial(2 * k + 2, k + 1));
+                }
+            }
+
         public:
 
             double getThreshold() const { return threshold; }
@@ -223,24 +440,34 @@
             PolarizeMove( Tmjson &in, Energy::Energybase<Tspace> &e, Tspace &s ) :
                 Tmove(in, e, s)
             {
-                threshold = in.value("pol_threshold", 0.001);
-                max_iter = in.value("max_iterations", 40);
+                setup(in);
             }
 
             template<class Tspace>
             PolarizeMove( Energy::Energybase<Tspace> &e, Tspace &s, Tmjson &j ) :
                 Tmove(e, s, j)
             {
-                threshold = j.value("pol_threshold", 0.001);
-                max_iter = j.value("max_iterations", 40);
+                setup(j);
             }
 
-            //PolarizeMove( const Tmove &m ) : max_iter(40), threshold(0.001), Tmove(m) {};
+            /** @brief Add polarisation to an already constructed move */
+            PolarizeMove( const Tmove &m, Tmjson &j ) : Tmove(m)
+            {
+                setup(j);
+            }
 
             double move( int n ) override
             {
+                // cached energy is void if `spc->p` was changed by others since last call
+                if ( uvalid )
+                    if ( snapshot.size() != spc->p.size()
+                        || !std::equal(snapshot.begin(), snapshot.end(), spc->p.begin(),
+                                       []( const Tparticle &a, const Tparticle &b ) { return !differs(a, b); }))
+                        uvalid = false;
                 Ntrials = 0;
-                return Tmove::move(n);
+                double du = Tmove::move(n);
+                snapshot = spc->p;
+                return du;
             }
         };
 
@@ -271,6 +498,7 @@
         private:
             unsigned long int cnt_accepted;  //!< number of accepted moves
             double dusum;                    //!< Sum of all energy changes
+            bool multipleTrialMove;          //!< True if last energy change came from multipleTrial()
 
             virtual void _test( UnitTest & );   //!< Unit testing
             virtual void _trialMove()=0;     //!< Do a trial move
@@ -314,9 +542,10 @@
                 Point dir;    // translational move directions
                 double dp1;   // displacement parameter 1
                 double dp2;   // displacement parameter 2
+                int ntrials;  // number of trial displacements per move (multiple-trial Metropolis)
 
                 MolListData() : prob(1.0), perAtom(false), perMol(false),
-                                repeat(1), Nattempts(0), Naccepted(0), dir(1, 1, 1), dp1(0), dp2(0) {}
+                                repeat(1), Nattempts(0), Naccepted(0), dir(1, 1, 1), dp1(0), dp2(0), ntrials(1) {}
 
                 MolListData( Tmjson &j )
                 {
@@ -324,6 +553,9 @@
                     prob = j.value("prob", 1.0);
                     perMol = j.value("permol", false);
                     perAtom = j.value("peratom", false);
+                    ntrials = j.value("ntrials", 1);
+                    if ( ntrials < 1 )
+                        throw std::runtime_error("ntrials must be positive");
                     dir << (j["dir"] | std::string("1 1 1"));
                 }
             };
@@ -348,6 +580,9 @@
                 }
             }
 
+            template<class Tpropose>
+            double multipleTrial( int, const vector<int> &, Group *, Tpropose, int & ); //!< Multiple-trial energy change
+
             /** @brief Internal, deterministic random number generator, independent of global */
             static RandomTwister<> &_slump()
             {
@@ -365,6 +600,27 @@
             void test( UnitTest & );              //!< Perform unit test
             double getAcceptance() const;      //!< Get acceptance [0:1]
 
+            /** @brief Number of moves accepted by all instances; used to detect changes made by other moves */
+            static unsigned long &acceptedMoves()
+            {
+                static unsigned long n = 0;
+                return n;
+            }
+
+            typedef std::function<void( const typename Tspace::Change & )> Tlistener;
+
+            /**
+             * @brief Functions called with the `Change` of each accepted move, keyed by owner
+             *
+             * Moves that bypass `acceptMove()` only increment `acceptedMoves()`
+             * so listeners must compare the two to detect unreported changes.
+             */
+            static std::map<const void *, Tlistener> &changeListeners()
+            {
+                static std::map<const void *, Tlistener> m;
+                return m;
+            }
+
             void addMol( int, const MolListData &d = MolListData()); //!< Specify molecule id to act upon
             Group *randomMol();
             int randomMolId();                 //!< Random mol id from mollist
@@ -379,8 +635,12 @@
                         {"trials", cnt},
                         {"acceptance", getAcceptance()},
                         {"runfraction", runfraction},
-                        {"relative time", timer.result()}
+                        {"relative time", timer.result()},
+                        {"time (s)", timer.seconds()}
                     };
+#ifdef FAU_PROFILE
+                    j[title]["profile"] = Profiler::instance().json(title);
+#endif
                     j = merge(j, _json());
                 }
                 return j;
@@ -404,6 +664,7 @@
             spc = &s;
             cnt = cnt_accepted = 0;
             dusum = 0;
+            multipleTrialMove = false;
             w = 30;
             runfraction = 1;
             useAlternativeReturnEnergy = false; //this has no influence on metropolis sampling!
@@ -434,7 +695,7 @@
                     if ( it->second.perMol )
                         it->second.repeat *= spc->numMolecules(it->first);
                     if ( it->second.perAtom )
-                        it->second.repeat *= spc->findMolecules(it->first).front()->size();
+                        it->second.repeat *= spc->molecules(it->first).front()->size();
                     return it->first;
                 }
             }
@@ -452,7 +713,7 @@
             if ( !mollist.empty())
             {
                 auto it = _slump().element(mollist.begin(), mollist.end());
-                auto g = spc->findMolecules(it->first); // vector of group pointers
+                auto &g = spc->molecules(it->first); // vector of group pointers
                 if ( !g.empty())
                     gPtr = *_slump().element(g.begin(), g.end());
             }
@@ -474,7 +735,10 @@
         void Movebase<Tspace>::acceptMove()
         {
             cnt_accepted++;
+            acceptedMoves()++;
             _acceptMove();
+            for ( auto &l : changeListeners())
+                l.second(change);
         }
 
         template<class Tspace>
@@ -487,6 +751,7 @@
         template<class Tspace>
         double Movebase<Tspace>::energyChange()
         {
+            multipleTrialMove = false;
             double du = _energyChange();
             if ( std::isnan(du))
                 std::cerr << "Warning: energy change from move returns not-a-number (NaN)" << endl;
@@ -511,6 +776,7 @@
         template<class Tspace>
         double Movebase<Tspace>::move( int n )
         {
+            FAU_PROFILE_MOVE(title);
             timer.start();
             double utot = 0;
 
@@ -526,22 +792,34 @@
                 bool acceptance = true;
                 while ( n-- > 0 )
                 {
-                    trialMove();
-                    pot->updateChange(change);
-
-                    double du = energyChange();
+                    double du;
+                    {
+                        FAU_PROFILE_PHASE("trial move");
+                        trialMove();
+                    }
+                    {
+                        FAU_PROFILE_PHASE("energy change");
+                        pot->updateChange(change);
+                        du = energyChange();
+                    }
                     acceptance = metropolis(du); // true or false?
-                    if ( !acceptance )
-                        rejectMove();
-                    else
                     {
-                        acceptMove();
-                        if ( useAlternativeReturnEnergy )
-                            du = alternateReturnEnergy;
-                        dusum += du;
-                        utot += du;
+                        FAU_PROFILE_PHASE("accept/reject");
+                        if ( !acceptance )
+                            rejectMove();
+                        else
+                        {
+                            acceptMove();
+                            if ( useAlternativeReturnEnergy || multipleTrialMove )
+                                du = alternateReturnEnergy;
+                            dusum += du;
+                            utot += du;
+                        }
+                    }
+                    {
+                        FAU_PROFILE_PHASE("update");
+                        utot += pot->update(acceptance);
                     }
-                    utot += pot->update(acceptance);
                     change.clear();
                 }
             }
@@ -550,6 +828,145 @@
             return utot;
         }
 
+        /**
+         * Multiple-trial Metropolis (MTM) for symmetric displacements of the
+         * particles in `index`. The moved particles are assumed to be registered
+         * in `change`. From the current configuration, \f$x\f$, `k` candidates,
+         * \f$y_j\f$, are drawn and one, \f$y\f$, is selected with probability
+         * proportional to \f$w(y_j)=e^{-\beta\Delta U(y_j)}\f$. Then `k-1`
+         * reference configurations, \f$x^*_j\f$, are drawn from \f$y\f$ and
+         * \f$x^*_k=x\f$. The move is accepted with probability
+         * \f$\min(1, \sum_j w(y_j) / \sum_j w(x^*_j))\f$ which is returned as an
+         * effective energy so that `move()` may apply its usual Metropolis test.
+         * The true energy change of \f$y\f$ is set as alternative return energy and
+         * the selected candidate is left in `spc->trial`.
+         *
+         * Each configuration is loaded into `spc->trial`, including `cm_trial` of
+         * molecular groups, followed by `Energybase::updateChange()` so that energy
+         * terms caching trial state, e.g. Ewald summation or SASA, see the
+         * configuration being evaluated. The selected candidate is loaded last,
+         * leaving these caches in sync with it before `update()` is called.
+         * Because of this shared state, configurations are evaluated one at a time.
+         *
+         * @param k Number of trials
+         * @param index Particles to move
+         * @param g Group containing `index` or `nullptr`; `cm_trial` is kept in sync for molecular groups
+         * @param propose Functor, `propose(c)`, displacing `index` in `spc->trial` from the
+         *        configuration found there. `c<k` for candidates and `c>=k` for references.
+         * @param selected Index of the selected candidate
+         * @return Effective energy change, \f$-\ln(\sum_j w(y_j) / \sum_j w(x^*_j))\f$ (kT)
+         *
+         * [More info](http://dx.doi.org/10.1198/016214500750350475)
+         */
+        template<class Tspace>
+        template<class Tpropose>
+        double Movebase<Tspace>::multipleTrial(
+            int k, const vector<int> &index, Group *g, Tpropose propose, int &selected )
+        {
+            typedef vector<typename Tspace::ParticleType> Tstate;
+            size_t n = index.size();
+            assert(k > 0 && n > 0);
+
+            // load state into trial vector
+            auto load = [&]( const Tstate &s )
+            {
+                for ( size_t i = 0; i < n; i++ )
+                    spc->trial[index[i]] = s[i];
+                if ( g != nullptr && g->isMolecular())
+                    g->cm_trial = Geometry::massCenter(spc->geo, spc->trial, *g);
+            };
+
+            // draw `m` configurations from `s`
+            auto draw = [&]( const Tstate &s, vector<Tstate> &v, int m, int offset )
+            {
+                v.resize(m);
+                for ( int c = 0; c < m; c++ )
+                {
+                    load(s);
+                    propose(c + offset);
+                    v[c].resize(n);
+                    for ( size_t i = 0; i < n; i++ )
+                        v[c][i] = spc->trial[index[i]];
+                }
+            };
+
+            // energy change of a configuration in `spc->trial` relative to `spc->p`
+            double uold = Energy::energyChangeConfiguration(*spc, *pot, spc->p, change);
+            auto trialEnergy = [&]()
+            {
+                pot->updateChange(change);
+                for ( auto i : index )
+                    if ( spc->geo.collision(spc->trial[i], spc->trial[i].radius,
+                                            Geometry::Geometrybase::BOUNDARY))
+                        return pc::infty;
+                return Energy::energyChangeConfiguration(*spc, *pot, spc->trial, change) - uold;
+            };
+
+            auto energy = [&]( const vector<Tstate> &v )
+            {
+                vector<double> u(v.size());
+                for ( size_t c = 0; c < v.size(); c++ )
+                {
+                    load(v[c]);
+                    u[c] = trialEnergy();
+                }
+                return u;
+            };
+
+            // ln sum_j exp(-u_j)
+            auto lnsum = []( const vector<double> &u, double umin )
+            {
+                double s = 0;
+                for ( auto uj : u )
+                    s += std::exp(-(uj - umin));
+                return std::log(s) - umin;
+            };
+
+            multipleTrialMove = true;
+            Tstate x(n);
+            for ( size_t i = 0; i < n; i++ )
+                x[i] = spc->p[index[i]];
+
+            vector<Tstate> y, xref;
+            draw(x, y, k, 0);
+            auto uy = energy(y);
+            double umin = *std::min_element(uy.begin(), uy.end());
+            if ( umin == pc::infty )
+            {
+                load(x);
+                selected = 0;
+                alternateReturnEnergy = pc::infty;
+                return pc::infty;
+            }
+
+            // select candidate with probability w(y_j)/sum w(y_j)
+            double r = slump() * std::exp(lnsum(uy, umin) + umin), s = 0;
+            selected = k - 1;
+            for ( int c = 0; c < k; c++ )
+                if ( uy[c] < pc::infty )
+                {
+                    s += std::exp(-(uy[c] - umin));
+                    if ( s >= r )
+                    {
+                        selected = c;
+                        break;
+                    }
+                }
+            while ( uy[selected] == pc::infty )
+                selected--;
+
+            // reference configurations from y; the last is x itself (u=0)
+            draw(y[selected], xref, k - 1, k);
+            auto ux = energy(xref);
+            ux.push_back(0);
+            double uxmin = *std::min_element(ux.begin(), ux.end());
+
+            load(y[selected]);
+            trialEnergy(); // leave trial state of energy terms at `y`
+            alternateReturnEnergy = uy[selected];
+            return lnsum(ux, uxmin) - lnsum(uy, umin);
+        }
+
         /**
          * @param du Energy change for MC move (kT)
          * @return True if move should be accepted; false if not.
@@ -644,10 +1061,17 @@
          * the box boundaries, the PBC boundary control should be set
          * to true.
          *
-         *  Keyword  | Description
-         *  -------- | ---------------
-         *  `file`   | Trajectory file to load (.xtc)
-         *  `trump`  | Enforce (PBC) boundary control (default: false)
+         *  Keyword      | Description
+         *  ------------ | ---------------
+         *  `file`       | Trajectory file to load (.xtc)
+         *  `trump`      | Enforce (PBC) boundary control (default: false)
+         *  `first`      | First frame to load (default: 0)
+         *  `stride`     | Load every n'th frame (default: 1)
+         *  `indexcache` | Save/reuse the frame index in `<file>.idx` (default: false)
+         *
+         * If `first` or `stride` differ from their defaults, a frame index
+         * is built (or read from `<file>.idx` if `indexcache=true`) and frames
+         * are accessed directly without decompressing skipped frames.
          *
          * Notes:
          *
@@ -667,6 +1091,7 @@
             int framecnt;
             string file;
             bool applyPBC; // true if PBC should be applied to loaded frames
+            size_t frame, stride; // next frame to load; frame increment
 
             void _acceptMove() override {};
             void _rejectMove() override {};
@@ -682,6 +1107,7 @@
                     j = {
                         { "file", file },
                         { "boundary control", applyPBC },
+                        { "stride", stride },
                         { "frames loaded", framecnt}
                     };
                 }
@@ -691,7 +1117,13 @@
             void _trialMove() override
             {
                 if (_continue)
-                    _continue = xtc.loadnextframe( *base::spc, true, applyPBC );
+                {
+                    if ( xtc.numFrames() > 0 )
+                        _continue = xtc.loadframe( frame, *base::spc, true, applyPBC );
+                    else
+                        _continue = xtc.loadnextframe( *base::spc, true, applyPBC );
+                    frame += stride;
+                }
                 if (_continue)
                     framecnt++;
             }
@@ -704,8 +1136,15 @@
                 base::title = "XTC Trajectory Move";
                 file = j.at("file");
                 applyPBC = j.value("trump", false);
+                frame = j.value("first", 0);
+                stride = j.value("stride", 1);
+                if ( stride < 1 )
+                    throw std::runtime_error(base::title + ": stride must be positive");
                 if ( xtc.open(file) == false)
                     throw std::runtime_error(base::title + ": xtc file " + file + " cannot be loaded");
+                if ( frame > 0 || stride > 1 )
+                    if ( xtc.buildindex( j.value("indexcache", false) ) == 0 )
+                        throw std::runtime_error(base::title + ": no frames found in " + file);
             }
 
             bool eof() { return _continue; } //!< True if all frames have been loaded
@@ -721,6 +1160,9 @@
          * The move directions can be controlled with the dir vector - for instance if you wish
          * to translate only in the `z` direction, set `dir.x()=dir.y()=0`.
          *
+         * If `ntrials` is larger than one, each move draws this number of candidate
+         * displacements and uses multiple-trial Metropolis, see `Movebase::multipleTrial()`.
+         *
          * @date Lund, 2011
          */
         template<class Tspace>
@@ -746,6 +1188,9 @@
             Group *igroup;   //!< Group pointer in which particles are moved randomly (NULL if none, default)
             double genericdp;//!< Generic atom displacement parameter - ignores individual dps
             Average<unsigned long long int> gsize; //!< Average size of igroup;
+            int ntrials;     //!< Number of trial displacements per move (default: 1)
+            double displacementParameter(); //!< Displacement parameter of `iparticle`
+            virtual Point displacement();   //!< Random displacement of `iparticle`
 
         public:
 
@@ -768,6 +1213,7 @@
          * `peratom`            | Repeat move for each atom in molecule (default: false)
          * `permol`             | Repeat move for each molecule in system (default: false)
          * `prob`               | Probability of performing the move (default: 1)
+         * `ntrials`            | Candidate displacements per move (multiple-trial Metropolis, default: 1)
          *
          * Example:
          *
@@ -786,6 +1232,7 @@
             igroup = nullptr;
             dir = {1, 1, 1};
             genericdp = 0;
+            ntrials = 1;
             base::fillMolList(j);
         }
 
@@ -803,7 +1250,7 @@
         bool AtomicTranslation<Tspace>::run()
         {
             if ( !this->mollist.empty() )
-                if ( spc->findMolecules(this->currentMolId).empty() )
+                if ( spc->molecules(this->currentMolId).empty() )
                     return false;
             if ( igroup != nullptr )
                 if ( igroup->empty())
@@ -811,16 +1258,34 @@
             return base::run();
         }
 
+        template<class Tspace>
+        double AtomicTranslation<Tspace>::displacementParameter()
+        {
+            double dp = atom[spc->p.at(iparticle).id].dp;
+            return (dp < 1e-6) ? genericdp : dp;
+        }
+
+        template<class Tspace>
+        Point AtomicTranslation<Tspace>::displacement()
+        {
+            Point t = dir * displacementParameter();
+            t.x() *= slump() - 0.5;
+            t.y() *= slump() - 0.5;
+            t.z() *= slump() - 0.5;
+            return t;
+        }
+
         template<class Tspace>
         void AtomicTranslation<Tspace>::_trialMove()
         {
             if ( !this->mollist.empty())
             {
-                auto gvec = spc->findMolecules(this->currentMolId);
+                auto &gvec = spc->molecules(this->currentMolId);
                 assert(!gvec.empty());
                 igroup = *slump.element(gvec.begin(), gvec.end());
                 assert(!igroup->empty());
                 dir = this->mollist[this->currentMolId].dir;
+                ntrials = this->mollist[this->currentMolId].ntrials;
             }
 
             if ( igroup != nullptr )
@@ -828,18 +1293,11 @@
                 iparticle = igroup->random();
                 gsize += igroup->size();
             }
-            if ( iparticle > -1 )
+            if ( iparticle > -1 && ntrials == 1 ) // multiple trials are drawn in _energyChange()
             {
-                double dp = atom[spc->p.at(iparticle).id].dp;
-                if ( dp < 1e-6 )
-                    dp = genericdp;
                 assert(iparticle < (int) spc->p.size()
                            && "Trial particle out of range");
-                Point t = dir * dp;
-                t.x() *= slump() - 0.5;
-                t.y() *= slump() - 0.5;
-                t.z() *= slump() - 0.5;
-                spc->trial[iparticle].translate(spc->geo, t);
+                spc->trial[iparticle].translate(spc->geo, displacement());
 
                 // make sure trial mass center is updated for molecular groups
                 // (certain energy functions may rely on up-to-date mass centra)
@@ -891,6 +1349,13 @@
             {
                 assert(spc->geo.collision(spc->p[iparticle], spc->p[iparticle].radius) == false
                            && "An untouched particle collides with simulation container.");
+                if ( ntrials > 1 )
+                {
+                    int selected;
+                    return base::multipleTrial(ntrials, {iparticle}, spc->findGroup(iparticle),
+                                               [&]( int ) { spc->trial[iparticle].translate(spc->geo, displacement()); },
+                                               selected);
+                }
                 return Energy::energyChange(*spc, *base::pot, base::change);
             }
             return 0;
@@ -906,6 +1371,8 @@
                   << base::cnt / gsize.avg() << endl;
             o << pad(SUB, base::w, "Displacement vector")
               << dir.transpose() << endl;
+            if ( ntrials > 1 )
+                o << pad(SUB, base::w, "Trials per move") << ntrials << endl;
             if ( genericdp > 1e-6 )
                 o << pad(SUB, base::w, "Generic displacement")
                   << genericdp << _angstrom << endl;
@@ -962,6 +1429,78 @@
             return js;
         }
 
+        /**
+         * @brief Force-biased (smart Monte Carlo) translation of atomic particles
+         *
+         * As `AtomicTranslation`, but the displacement is drawn from a Gaussian
+         * centered along the pair force, \f$\mathbf{F}\f$, on the particle,
+         *
+         * \f[
+         *     \Delta\mathbf{r} = A\beta\mathbf{F} + \sqrt{2A}\boldsymbol{\xi}
+         * \f]
+         *
+         * where \f$\boldsymbol{\xi}\f$ is a vector of unit normal random numbers and
+         * \f$\sqrt{2A}\f$ is the atomic displacement parameter, `AtomData::dp`.
+         * Each component is further scaled by the move direction, `dir`, which
+         * is included in the proposal probability.
+         * The asymmetric proposal is corrected for in the acceptance criterion using
+         * the force in the new position. Forces are summed from `Energybase::f_p2p()`.
+         * Since any bias is corrected for, external potentials or other terms lacking
+         * a force merely reduce the efficiency. The JSON input is identical to
+         * `AtomicTranslation` except that `ntrials` must be one.
+         *
+         * [More info](http://dx.doi.org/10.1063/1.436415)
+         */
+        template<class Tspace>
+        class ForceBiasedTranslation : public AtomicTranslation<Tspace>
+        {
+        protected:
+            typedef AtomicTranslation<Tspace> base;
+            using base::spc;
+            using base::iparticle;
+            using base::dir;
+            std::normal_distribution<double> gauss;
+            Point dr;     // trial displacement
+            Point fold;   // force in old position
+            double A;     // diffusion coefficient times time step (angstrom^2)
+
+            /** @brief Displacement along the force on `iparticle` */
+            Point displacement() override
+            {
+                double dp = base::displacementParameter();
+                A = dp * dp / 2;
+                fold = Energy::forces(*base::pot, spc->p, {iparticle}, Group()).front();
+                for ( int d = 0; d < 3; d++ )
+                    dr[d] = dir[d] * (A * fold[d] + dp * gauss(slump.eng));
+                return dr;
+            }
+
+            double _energyChange() override
+            {
+                base::alternateReturnEnergy = base::_energyChange();
+                if ( base::alternateReturnEnergy == pc::infty || iparticle < 0 || A < 1e-12 )
+                    return base::alternateReturnEnergy;
+                Point fnew = Energy::forces(*base::pot, spc->trial, {iparticle}, Group()).front();
+                double bias = 0; // ln T(old->new) - ln T(new->old); variance of component d is 2A*dir^2
+                for ( int d = 0; d < 3; d++ )
+                    if ( std::fabs(dir[d]) > 1e-6 )
+                        bias += (pow(-dr[d] - dir[d] * A * fnew[d], 2) - pow(dr[d] - dir[d] * A * fold[d], 2))
+                            / (dir[d] * dir[d]);
+                return base::alternateReturnEnergy + bias / (4 * A);
+            }
+
+        public:
+            ForceBiasedTranslation( Energy::Energybase<Tspace> &e, Tspace &s, Tmjson &j ) : base(e, s, j), A(0)
+            {
+                base::title = "Force-biased Particle Translation";
+                base::cite = "doi:10.1063/1.436415";
+                base::useAlternativeReturnEnergy = true;
+                for ( auto &m : this->mollist )
+                    if ( m.second.ntrials != 1 )
+                        throw std::runtime_error(base::title + ": multiple trials (`ntrials`) not supported");
+            }
+        };
+
         /**
          * @brief Rotate single particles
          *
@@ -1204,7 +1743,9 @@
          * @brief Combined rotation and rotation of groups
          *
          * This will translate and rotate groups and collect averages based on group name.
-         * See constructor for usage.
+         * See constructor for usage. With `ntrials` larger than one, each move draws this
+         * number of candidate displacements and uses multiple-trial Metropolis, see
+         * `Movebase::multipleTrial()`.
          */
         template<class Tspace>
         class TranslateRotate : public Movebase<Tspace>
@@ -1232,6 +1773,9 @@
             double dp_trans;   //!< Translational displacement parameter
             double angle;      //!< Temporary storage for current angle
             Point dir;         //!< Translation directions (default: x=y=z=1). This will be set by setGroup()
+            int ntrials;       //!< Number of trial displacements per move (default: 1)
+            vector<double> angles; //!< Rotation angle of each candidate
+            double displace(); //!< Random rotation and translation of `igroup` in trial vector
 
         public:
 
@@ -1255,6 +1799,7 @@
          * `prob`     | Probability of performing the move (default: 1)
          * `dp`       | Translational displacement parameter (angstrom, default: 0)
          * `dprot`    | Angular displacement parameter (radians, default: 0)
+         * `ntrials`  | Candidate displacements per move (multiple-trial Metropolis, default: 1)
          *
          * Example:
          *
@@ -1279,6 +1824,7 @@
             base::w = 30;
             igroup = nullptr;
             groupWiseEnergy = false;
+            ntrials = 1;
 
             base::fillMolList(j);// find molecules to be moved
 
@@ -1313,7 +1859,7 @@
             // Note that `currentMolId` is set by Movebase::move()
             if ( !this->mollist.empty())
             {
-                auto gvec = spc->findMolecules(this->currentMolId);
+                auto &gvec = spc->molecules(this->currentMolId);
                 assert(!gvec.empty());
                 igroup = *slump.element(gvec.begin(), gvec.end());
                 assert(!igroup->empty());
@@ -1323,25 +1869,13 @@
                     dp_trans = it->second.dp1;
                     dp_rot = it->second.dp2;
                     dir = it->second.dir;
+                    ntrials = it->second.ntrials;
                 }
             }
 
             assert(igroup != nullptr);
-            Point p;
-            if ( dp_rot > 1e-6 )
-            {
-                p.ranunit(slump);             // random unit vector
-                p = igroup->cm + p;                    // set endpoint for rotation
-                angle = dp_rot * slump.half();
-                igroup->rotate(*spc, p, angle);
-            }
-            if ( dp_trans > 1e-6 )
-            {
-                p.x() = dir.x() * dp_trans * slump.half();
-                p.y() = dir.y() * dp_trans * slump.half();
-                p.z() = dir.z() * dp_trans * slump.half();
-                igroup->translate(*spc, p);
-            }
+            if ( ntrials == 1 ) // multiple trials are drawn in _energyChange()
+                angle = displace();
 
             // register the moved group but set the number of moved particles
             // to zero. Doing so, it is assumed that all particles have been moved and
@@ -1350,6 +1884,44 @@
             base::change.mvGroup[g_index].clear();
         }
 
+        /**
+         * Rotates around the trial mass center and then translates. The group
+         * may hence be displaced repeatedly from any trial configuration.
+         *
+         * @return Rotation angle (radians)
+         */
+        template<class Tspace>
+        double TranslateRotate<Tspace>::displace()
+        {
+            double a = 0;
+            if ( dp_rot > 1e-6 )
+            {
+                Point u;
+                u.ranunit(slump);             // random unit vector
+                a = dp_rot * slump.half();
+                Geometry::QuaternionRotate vrot1;
+                vrot1.setAxis(spc->geo, igroup->cm_trial, igroup->cm_trial + u, a);
+                auto vrot2 = vrot1;
+                vrot2.getOrigin() = Point(0, 0, 0);
+                for ( auto i : *igroup )
+                {
+                    spc->trial[i] = vrot1(spc->trial[i]); // rotate coordinates
+                    spc->trial[i].rotate(vrot2);         // rotate internal coordinates
+                }
+            }
+            if ( dp_trans > 1e-6 )
+            {
+                Point t;
+                t.x() = dir.x() * dp_trans * slump.half();
+                t.y() = dir.y() * dp_trans * slump.half();
+                t.z() = dir.z() * dp_trans * slump.half();
+                igroup->cm_trial.translate(spc->geo, t);
+                for ( auto i : *igroup )
+                    spc->trial[i].translate(spc->geo, t);
+            }
+            return a;
+        }
+
         template<class Tspace>
         void TranslateRotate<Tspace>::_acceptMove()
         {
@@ -1375,6 +1947,22 @@
             if ( dp_rot < 1e-6 && dp_trans < 1e-6 )
                         return 0;
 
+            if ( ntrials > 1 )
+            {
+                int selected;
+                angles.resize(ntrials);
+                double du = base::multipleTrial(
+                    ntrials, vector<int>(igroup->begin(), igroup->end()), igroup,
+                    [&]( int c )
+                    {
+                        double a = displace();
+                        if ( c < ntrials )
+                            angles[c] = a;
+                    }, selected);
+                angle = angles[selected];
+                return du;
+            }
+
             return Energy::energyChange(*spc, *base::pot, base::change);
 
             // The code below is obsolete and will be removed in the future.
@@ -1399,6 +1987,8 @@
             std::ostringstream o;
             o << pad(SUB, w, "Max. translation") << pm << dp_trans / 2 << textio::_angstrom << endl
               << pad(SUB, w, "Max. rotation") << pm << dp_rot / 2 * 180 / pc::pi << textio::degrees << endl;
+            if ( ntrials > 1 )
+                o << pad(SUB, w, "Trials per move") << ntrials << endl;
             if ( !directions.empty())
             {
                 o << indent(SUB) << "Group Move directions:" << endl;
@@ -1457,6 +2047,128 @@
             }
         }
 
+        /**
+         * @brief Force-biased (smart Monte Carlo) translation and rotation of groups
+         *
+         * As `TranslateRotate`, but the translation and the rotation vector are
+         * drawn from Gaussians centered along the total pair force, \f$\mathbf{F}\f$,
+         * and torque, \f$\boldsymbol{\tau}\f$, on the group from all other particles,
+         *
+         * \f[
+         *     \Delta\mathbf{r} = A_t\beta\mathbf{F} + \sqrt{2A_t}\boldsymbol{\xi}_t
+         *     \quad\quad
+         *     \boldsymbol{\omega} = A_r\beta\boldsymbol{\tau} + \sqrt{2A_r}\boldsymbol{\xi}_r
+         * \f]
+         *
+         * where \f$\sqrt{2A_t}\f$ and \f$\sqrt{2A_r}\f$ are given by the
+         * displacement parameters `dp` and `dprot`. The group is rotated by
+         * \f$|\boldsymbol{\omega}|\f$ around \f$\boldsymbol{\omega}\f$ and then
+         * translated. The asymmetric proposal is corrected for in the acceptance
+         * criterion using forces and torques in the new configuration; for the
+         * rotation this is exact when `dprot` is small compared to \f$\pi\f$.
+         * Forces on all particles in the group are evaluated in parallel (OpenMP).
+         * The JSON input is identical to `TranslateRotate`.
+         *
+         * [More info](http://dx.doi.org/10.1063/1.436415)
+         */
+        template<class Tspace>
+        class ForceBiasedTranslateRotate : public TranslateRotate<Tspace>
+        {
+        protected:
+            typedef TranslateRotate<Tspace> base;
+            using base::spc;
+            using base::igroup;
+            using base::dp_trans;
+            using base::dp_rot;
+            using base::dir;
+            using base::angle;
+            std::normal_distribution<double> gauss;
+            Point dr, omega;         // trial translation and rotation vector
+            Point fold, told;        // force and torque in old configuration
+
+            /** @brief Total force and torque on `igroup` */
+            std::pair<Point, Point> forceTorque( const typename Tspace::ParticleVector &p, const Point &cm )
+            {
+                vector<int> index(igroup->begin(), igroup->end());
+                auto f = Energy::forces(*base::pot, p, index, *igroup);
+                std::pair<Point, Point> ft(Point(0, 0, 0), Point(0, 0, 0));
+                for ( size_t k = 0; k < index.size(); k++ )
+                {
+                    ft.first += f[k];
+                    ft.second += spc->geo.vdist(p[index[k]], cm).cross(f[k]);
+                }
+                return ft;
+            }
+
+            void _trialMove() override
+            {
+                if ( !this->mollist.empty())
+                {
+                    auto &gvec = spc->molecules(this->currentMolId);
+                    assert(!gvec.empty());
+                    igroup = *slump.element(gvec.begin(), gvec.end());
+                    auto it = this->mollist.find(this->currentMolId);
+                    if ( it != this->mollist.end())
+                    {
+                        dp_trans = it->second.dp1;
+                        dp_rot = it->second.dp2;
+                        dir = it->second.dir;
+                    }
+                }
+                assert(igroup != nullptr);
+                std::tie(fold, told) = forceTorque(spc->p, igroup->cm);
+                angle = 0;
+                if ( dp_rot > 1e-6 )
+                {
+                    double A = dp_rot * dp_rot / 2;
+                    for ( int d = 0; d < 3; d++ )
+                        omega[d] = A * told[d] + dp_rot * gauss(slump.eng);
+                    angle = omega.norm();
+                    if ( angle > 1e-12 )
+                        igroup->rotate(*spc, igroup->cm + omega / angle, angle);
+                }
+                if ( dp_trans > 1e-6 )
+                {
+                    double A = dp_trans * dp_trans / 2;
+                    for ( int d = 0; d < 3; d++ )
+                        dr[d] = dir[d] * (A * fold[d] + dp_trans * gauss(slump.eng));
+                    igroup->translate(*spc, dr);
+                }
+                base::change.mvGroup[spc->findIndex(igroup)].clear();
+            }
+
+            double _energyChange() override
+            {
+                base::alternateReturnEnergy = base::_energyChange();
+                if ( base::alternateReturnEnergy == pc::infty || (dp_rot < 1e-6 && dp_trans < 1e-6))
+                    return base::alternateReturnEnergy;
+                Point fnew, tnew;
+                std::tie(fnew, tnew) = forceTorque(spc->trial, igroup->cm_trial);
+                double bias = 0; // ln T(old->new) - ln T(new->old)
+                if ( dp_rot > 1e-6 )
+                {
+                    double A = dp_rot * dp_rot / 2;
+                    bias += ((-omega - A * tnew).squaredNorm() - (omega - A * told).squaredNorm()) / (4 * A);
+                }
+                if ( dp_trans > 1e-6 )
+                {
+                    double A = dp_trans * dp_trans / 2;
+                    for ( int d = 0; d < 3; d++ )
+                        if ( dir[d] > 1e-6 )
+                            bias += (pow(-dr[d] - A * fnew[d], 2) - pow(dr[d] - A * fold[d], 2)) / (4 * A);
+                }
+                return base::alternateReturnEnergy + bias;
+            }
+
+        public:
+            ForceBiasedTranslateRotate( Energy::Energybase<Tspace> &e, Tspace &s, Tmjson &j ) : base(e, s, j)
+            {
+                base::title = "Force-biased Group Rotation/Translation";
+                base::cite = "doi:10.1063/1.436415";
+                base::useAlternativeReturnEnergy = true;
+            }
+        };
+
         /**
            * @brief Move that will swap conformation of a molecule
            *
@@ -1490,7 +2202,7 @@
 
             void _trialMove() override
             {
-                auto gvec = spc->findMolecules(base::currentMolId);
+                auto &gvec = spc->molecules(base::currentMolId);
                 assert(!gvec.empty());
                 igroup = *slump.element(gvec.begin(), gvec.end());
                 assert(igroup != nullptr); // make sure we really found a group
@@ -1759,6 +2471,15 @@
          * 2nd ed, p405 - and derived classes can re-implement `ClusterProbability()`
          * for arbitrary probability functions.
          *
+         * In `Cuboid` containers, mobile particles are kept in a cell list so
+         * that only those within `clusterRange()` of the main group are
+         * considered. Derived classes with a non-local `ClusterProbability()`
+         * must return infinity from `clusterRange()` to scan all mobile particles.
+         * Particles moved by this move are updated in the cell list upon acceptance.
+         * Only when other moves have been accepted in between are the positions
+         * of all mobile particles compared. Changes made to `Space::p` outside
+         * of `Movebase::move()` must be followed by a call to `setMobile()`.
+         *
          * In additon to the molecular keywords in
          * `Moves::TranslateRotate`, the JSON input is searched
          * the following in `moves/moltransrotcluster`,
@@ -1797,6 +2518,16 @@
             Average<double> avgbias; //!< Average bias
             Group *gmobile;          //!< Pointer to group with potential cluster particles
             virtual double ClusterProbability( Tpvec &, int ); //!< Probability that particle index belongs to cluster
+            virtual double clusterRange(); //!< Distance to main group beyond which `ClusterProbability()` is zero
+
+            Geometry::CellList cells;       //!< Cell list of mobile particles
+            vector<Point> cellpos;          //!< Positions of mobile particles in `cells`
+            int cellfront;                  //!< First index of mobile group in `cells`
+            unsigned long cellsync;         //!< Value of `acceptedMoves()` when `cells` were last in sync
+            double maxradius;               //!< Largest radius of mobile particles
+            vector<char> mark;              //!< Scratch flags indexed by particle
+            void syncCells();               //!< Update cell list with moved mobile particles
+            void nearby( Tpvec &, vector<int> & ); //!< Mobile particles that may belong to cluster
         public:
             using base::spc;
             TranslateRotateCluster( Energy::Energybase<Tspace> &, Tspace &, Tmjson &j );
@@ -1812,6 +2543,9 @@
             base::title = "Cluster " + base::title;
             base::cite = "doi:10/cj9gnn";
             gmobile = nullptr;
+            maxradius = 0;
+            cellfront = -1;
+            cellsync = 0;
 
             auto m = j;
             base::fillMolList(m);// find molecules to be moved
@@ -1845,14 +2579,89 @@
         void TranslateRotateCluster<Tspace>::setMobile( Group &g )
         {
             gmobile = &g;
+            cellpos.clear();
         }
 
         template<class Tspace>
-        string TranslateRotateCluster<Tspace>::_info()
+        double TranslateRotateCluster<Tspace>::clusterRange()
         {
-            using namespace textio;
-            std::ostringstream o;
-            o << base::_info() << endl;
+            double r = 0;
+            for ( auto j : *igroup )
+                r = std::max(r, double(spc->p[j].radius));
+            return threshold + r + maxradius;
+        }
+
+        template<class Tspace>
+        void TranslateRotateCluster<Tspace>::syncCells()
+        {
+            auto geo = dynamic_cast<Geometry::Cuboid *>(&spc->geo);
+            assert(geo != nullptr);
+            const int f = gmobile->front();
+            if ((int) cellpos.size() == gmobile->size() && cellfront == f && cellsync == base::acceptedMoves())
+                return; // no other moves accepted since last sync
+            cellsync = base::acceptedMoves();
+            if ((int) cellpos.size() != gmobile->size() || cellfront != f || cells.boxlen() != geo->len )
+            {
+                cellfront = f;
+                maxradius = 0;
+                for ( auto i : *gmobile )
+                    maxradius = std::max(maxradius, double(spc->p[i].radius));
+                cells.setCellSize(std::max(threshold + 2 * maxradius, 1e-3 * geo->len.minCoeff()));
+                cells.reset(geo->len);
+                cellpos.resize(gmobile->size());
+                for ( auto i : *gmobile )
+                {
+                    cellpos[i - f] = spc->p[i];
+                    cells.insert(i, spc->p[i]);
+                }
+                return;
+            }
+            for ( auto i : *gmobile )
+                if ( cellpos[i - f] != spc->p[i] )
+                {
+                    cellpos[i - f] = spc->p[i];
+                    cells.move(i, spc->p[i]);
+                }
+        }
+
+        /**
+         * Appends mobile particles that may have a non-zero `ClusterProbability()`
+         * for configuration `p` to `index` and flags them in `mark`. Flagged
+         * particles are skipped and mobile particles outside the main group
+         * must be at their positions in `spc->p`.
+         */
+        template<class Tspace>
+        void TranslateRotateCluster<Tspace>::nearby( Tpvec &p, vector<int> &index )
+        {
+            if ( !std::is_base_of<Geometry::Cuboid, typename Tspace::GeometryType>::value || clusterRange() == pc::infty )
+            {
+                for ( auto i : *gmobile )
+                    if ( !mark[i] )
+                    {
+                        mark[i] = 1;
+                        index.push_back(i);
+                    }
+                return;
+            }
+            syncCells(); // updates `maxradius` used by `clusterRange()`
+            double range = clusterRange();
+            for ( auto j : *igroup )
+                cells.forNeighbours(p[j], range, [&]( int i )
+                {
+                    if ( !mark[i] )
+                    {
+                        mark[i] = 1;
+                        index.push_back(i);
+                    }
+                });
+        }
+
+        template<class Tspace>
+        string TranslateRotateCluster<Tspace>::_info()
+        {
+            using namespace textio;
+            std::ostringstream o;
+            o << base::_info() << endl;
             o << pad(SUB, w, "Cluster threshold") << threshold << _angstrom << endl;
             if ( cnt > 0 )
             {
@@ -1871,7 +2680,7 @@
             // Note that `currentMolId` is set by Movebase::move()
             if ( !this->mollist.empty())
             {
-                auto gvec = spc->findMolecules(this->currentMolId);
+                auto &gvec = spc->molecules(this->currentMolId);
                 assert(!gvec.empty());
                 igroup = *slump.element(gvec.begin(), gvec.end());
                 assert(!igroup->empty());
@@ -1882,8 +2691,15 @@
             assert(igroup != nullptr && "Group to move not defined");
 
             // find clustered particles
+            vector<int> index;
+            if ( mark.size() != spc->p.size())
+                mark.assign(spc->p.size(), 0);
+            nearby(spc->p, index);
+            for ( auto i : index )
+                mark[i] = 0;
+            std::sort(index.begin(), index.end());
             cindex.clear();
-            for ( auto i : *gmobile )
+            for ( auto i : index )
                 if ( ClusterProbability(spc->p, i) > slump())
                     cindex.push_back(i); // generate cluster list
 
@@ -1919,6 +2735,15 @@
             for ( auto i : cindex )
                 spc->p[i] = spc->trial[i];
             avgsize += cindex.size();
+            if ( !cellpos.empty() && cellsync + 1 == base::acceptedMoves())
+            { // cell list was in sync before this move; update only the cluster
+                for ( auto i : cindex )
+                {
+                    cellpos[i - cellfront] = spc->p[i];
+                    cells.move(i, spc->p[i]);
+                }
+                cellsync = base::acceptedMoves();
+            }
         }
 
         template<class Tspace>
@@ -1934,9 +2759,17 @@
         {
             double bias = 1;             // cluster bias -- see Frenkel 2nd ed, p.405
             vector<int> imoved = cindex; // index of moved particles
-            for ( auto l : *gmobile )    // mobile index, "l", NOT in cluster (Frenkel's "k" is the main group)
-                if ( std::find(cindex.begin(), cindex.end(), l) == cindex.end())
-                    bias *= (1 - ClusterProbability(spc->trial, l)) / (1 - ClusterProbability(spc->p, l));
+            vector<int> index;           // mobile particles near main group before or after move
+            for ( auto i : cindex )
+                mark[i] = 1;
+            nearby(spc->p, index);
+            nearby(spc->trial, index);
+            for ( auto l : index )       // mobile index, "l", NOT in cluster (Frenkel's "k" is the main group)
+                bias *= (1 - ClusterProbability(spc->trial, l)) / (1 - ClusterProbability(spc->p, l));
+            for ( auto i : index )
+                mark[i] = 0;
+            for ( auto i : cindex )
+                mark[i] = 0;
             avgbias += bias;
             if ( bias < 1e-7 )
                 return pc::infty;        // don't bother to continue with energy calculation
@@ -1968,11 +2801,15 @@
             // pair energy between static and moved particles
             // note: this could be optimized!
             double du = 0;
+            for ( auto i : imoved )
+                mark[i] = 1;
 #pragma omp parallel for reduction (+:du)
             for ( int j = 0; j < (int) spc->p.size(); j++ )
-                if ( std::find(imoved.begin(), imoved.end(), j) == imoved.end())
+                if ( !mark[j] )
                     for ( auto i : imoved )
                         du += pot->i2i(spc->trial, i, j) - pot->i2i(spc->p, i, j);
+            for ( auto i : imoved )
+                mark[i] = 0;
             return unew - uold + du - log(bias); // exp[ -( dU-log(bias) ) ] = exp(-dU)*bias
         }
 
@@ -2023,9 +2860,11 @@
 
             double ClusterProbability( typename base::Tpvec &p, int i ) override { return 1; }
 
+            double clusterRange() override { return pc::infty; }
+
         public:
             TranslateRotateGroupCluster( Tmjson &j, Energy::Energybase<Tspace> &e,
-                                         Tspace &s ) : base(j, e, s)
+                                         Tspace &s ) : base(e, s, j)
             {
                 base::title = "Translate-Rotate w. extra group";
             }
@@ -2043,6 +2882,12 @@
          * While this has no influence on the Markov chain it will cause an apparent energy
          * drift. It is recommended that this is enabled only for long production runs after
          * having properly checked that no drifts occur with `skipEnergyUpdate=false`.
+         * The energy change is summed from the group pairs evaluated while building
+         * the cluster and is therefore cheap.
+         *
+         * If a mass center `cutoff` is given, beyond which the group-group energy is
+         * zero, groups are kept in a cell list and only those within reach of a moved
+         * group are tested. Without it, all remaining groups are tested.
          *
          * Upon construction the following keywords are read json section `moves/ctransnr`:
          *
@@ -2051,6 +2896,7 @@
          * `dp`        | Displacement parameter (default: 0)
          * `skipenergy`| Skip energy update, see above (default: false)
          * `prob`      | Runfraction (default: 1.0)
+         * `cutoff`    | Mass center cutoff of group-group energy (default: none)
          *
          * @note Requirements for usage:
          * - Compatible only with purely molecular systems
@@ -2059,8 +2905,6 @@
          *
          * @author Bjoern Persson
          * @date Lund 2009-2010
-         * @todo Energy calc. before and after can be optimized by only looping over `moved` with
-         * `remaining`
          */
         template<class Tspace>
         class ClusterTranslateNR : public Movebase<Tspace>
@@ -2070,8 +2914,14 @@
             using base::w;
             using base::spc;
             using base::pot;
-            vector<int> moved, remaining;
+            vector<int> moved;
+            vector<char> isMoved;     // true if group (index in `g`) is in cluster
+            vector<std::pair<int, double>> pairs; // tested remaining group and energy change
+            Geometry::CellList cells; // mass centers of groups
+            vector<Point> cellpos;    // mass centers registered in `cells`
+            double cutoff;            // mass center cutoff (infinity if none)
             void _trialMove() override;
+            void syncCells();
 
             void _acceptMove() override {}
 
@@ -2099,12 +2949,42 @@
             base::useAlternativeReturnEnergy = true;
             base::runfraction = _j["prob"] | 1.0;
             skipEnergyUpdate = _j["skipenergy"] | false;
+            cutoff = _j.value("cutoff", pc::infty);
             dp = _j.at("dp");
             if ( dp < 1e-6 )
                 base::runfraction = 0;
+            if ( cutoff < pc::infty )
+            {
+                if ( !std::is_base_of<Geometry::Cuboid, typename Tspace::GeometryType>::value )
+                    throw std::runtime_error(base::title + ": cutoff requires a Cuboid geometry");
+                cells.setCellSize(cutoff);
+            }
             g = spc->groupList(); // currently ALL groups in the system will be moved!
         }
 
+        template<class Tspace>
+        void ClusterTranslateNR<Tspace>::syncCells()
+        {
+            auto &len = dynamic_cast<Geometry::Cuboid &>(spc->geo).len;
+            if ( cellpos.size() != g.size() || cells.boxlen() != len )
+            {
+                cells.reset(len);
+                cellpos.resize(g.size());
+                for ( size_t i = 0; i < g.size(); i++ )
+                {
+                    cellpos[i] = g[i]->cm;
+                    cells.insert(i, cellpos[i]);
+                }
+                return;
+            }
+            for ( size_t i = 0; i < g.size(); i++ )
+                if ( cellpos[i] != g[i]->cm )
+                {
+                    cellpos[i] = g[i]->cm;
+                    cells.move(i, cellpos[i]);
+                }
+        }
+
         template<class Tspace>
         string ClusterTranslateNR<Tspace>::_info()
         {
@@ -2113,6 +2993,8 @@
             o << pad(SUB, w, "Displacement") << dp << _angstrom << endl
               << pad(SUB, w, "Skip energy update") << std::boolalpha
               << skipEnergyUpdate << endl;
+            if ( cutoff < pc::infty )
+                o << pad(SUB, w, "Mass center cutoff") << cutoff << _angstrom << endl;
             if ( movefrac.cnt > 0 )
             {
                 o << pad(SUB, w, "Move fraction") << movefrac.avg() * 100 << percent << endl
@@ -2124,64 +3006,456 @@
         template<class Tspace>
         void ClusterTranslateNR<Tspace>::_trialMove()
         {
-            double du = 0;
             g = spc->groupList();
             moved.clear();
-            remaining.resize(g.size());
+            pairs.clear();
+            isMoved.assign(g.size(), 0);
 
-            for ( size_t i = 0; i < g.size(); i++ )
-            {
-                remaining[i] = i;
-                if ( base::cnt <= 1 )
-                    g[i]->setMassCenter(*spc);
-            }
-
-            if ( skipEnergyUpdate == false )
-#pragma omp parallel for reduction (+:du) schedule (dynamic)
-                for ( size_t i = 0; i < g.size() - 1; i++ )
-                    for ( size_t j = i + 1; j < g.size(); j++ )
-                        du -= pot->g2g(spc->p, *g[i], *g[j]);
+            if ( base::cnt <= 1 )
+                for ( auto i : g )
+                    i->setMassCenter(*spc);
+            if ( cutoff < pc::infty )
+                syncCells();
 
             Point ip(dp, dp, dp);
             ip.x() *= slump.half();
             ip.y() *= slump.half();
             ip.z() *= slump.half();
 
-            int f = slump() * remaining.size();
-            moved.push_back(remaining[f]);
-            remaining.erase(remaining.begin() + f);    // Pick first index in m to move
+            int f = slump() * g.size();
+            moved.push_back(f);    // Pick first group to move
+            isMoved[f] = 1;
 
-            for ( size_t i = 0; i < moved.size(); i++ )
+            // Remaining groups that are tested for linking to moved group `i`.
+            // With a cutoff, only groups closer than cutoff+|ip| to the old mass
+            // center can interact with `i` before or after the move.
+            auto test = [&]( int i, int j )
             {
-                g[moved[i]]->translate(*spc, ip);
-                for ( size_t j = 0; j < remaining.size(); j++ )
+                if ( isMoved[j] )
+                    return;
+                double uo = pot->g2g(spc->p, *g[i], *g[j]);
+                double un = pot->g2g(spc->trial, *g[i], *g[j]);
+                double udiff = un - uo;
+                if ( slump() < (1. - std::exp(-udiff)))
                 {
-                    double uo = pot->g2g(spc->p, *g[moved[i]], *g[remaining[j]]);
-                    double un = pot->g2g(spc->trial, *g[moved[i]], *g[remaining[j]]);
-                    double udiff = un - uo;
-                    if ( slump() < (1. - std::exp(-udiff)))
-                    {
-                        moved.push_back(remaining[j]);
-                        remaining.erase(remaining.begin() + j);
-                        j--;
-                    }
+                    moved.push_back(j);
+                    isMoved[j] = 1;
                 }
-                g[moved[i]]->accept(*spc);
+                else
+                    pairs.push_back({j, udiff});
+            };
+
+            for ( size_t k = 0; k < moved.size(); k++ )
+            {
+                int i = moved[k];
+                Point cm = g[i]->cm;
+                g[i]->translate(*spc, ip);
+                if ( cutoff < pc::infty )
+                    cells.forNeighbours(cm, cutoff + ip.norm(), [&]( int j ) { test(i, j); });
+                else
+                    for ( size_t j = 0; j < g.size(); j++ )
+                        test(i, j);
+                g[i]->accept(*spc);
             }
 
+            // Pairs of moved groups keep their energy so the change comes only from
+            // pairs between moved and non-moved groups, each tested exactly once.
+            double du = 0;
             if ( skipEnergyUpdate == false )
-#pragma omp parallel for reduction (+:du) schedule (dynamic)
-                for ( size_t i = 0; i < g.size() - 1; i++ )
-                    for ( size_t j = i + 1; j < g.size(); j++ )
-                        du += pot->g2g(spc->p, *g[i], *g[j]);
+                for ( auto &i : pairs )
+                    if ( !isMoved[i.first] )
+                        du += i.second;
 
             base::alternateReturnEnergy = du;
-            movefrac += double(moved.size()) / (moved.size() + remaining.size());
+            movefrac += double(moved.size()) / g.size();
 
             assert(moved.size() >= 1);
-            assert(spc->groupList().size() == moved.size() + remaining.size());
         }
 
+        /**
+         * @brief Checkerboard domain-parallel sweep for short-ranged Hamiltonians
+         *
+         * A `Cuboid` is divided into an even number of domains in each direction,
+         * each at least as wide as the interaction `cutoff` plus the largest
+         * molecular diameter. Domains are coloured as a three dimensional checkerboard
+         * so that no two domains of the same colour are neighbours. For each colour,
+         * taken in random order, the domains are swept in parallel (OpenMP): every
+         * movable particle or molecule in a domain is, on average, displaced once and
+         * accepted or rejected with a local Metropolis criterion. Moves that take the
+         * particle position or molecular mass center out of its domain are rejected
+         * so that same-coloured domains never interact and the trials commute.
+         * The domain grid is shifted by a random offset every sweep to maintain
+         * detailed balance and ergodicity.
+         *
+         * Single atoms in atomic groups are translated using `AtomData::dp` while
+         * molecular groups are rigidly translated and rotated as in
+         * `TranslateRotate`. Each domain has its own random number generator,
+         * seeded from the global generator, so that the sweep is reproducible
+         * independently of the number of threads.
+         *
+         * The energy change of a trial is the sum of `Energybase::i2i()` over
+         * particles in the neighbouring domains plus external potentials. The
+         * Hamiltonian must therefore be pairwise additive and vanish beyond `cutoff`
+         * (`LennardJones`, `HardSphere`, `SquareWell`, `CutShift<...>` etc.), and
+         * free of trial state (`updateChange()`/`update()` are not called).
+         *
+         * The JSON input is read from `moves/checkerboard`:
+         *
+         * Keyword     | Description
+         * :---------- | :-------------------------------------------------------
+         * `cutoff`    | Interaction range (angstrom, required)
+         * `prob`      | Probability of performing a sweep (default: 1)
+         *
+         * followed by the molecules to move, each with the keywords,
+         *
+         * Keyword     | Description
+         * :---------- | :-------------------------------------------------------
+         * `dp`        | Translational displacement of molecular groups (angstrom, default: 0)
+         * `dprot`     | Rotational displacement of molecular groups (radians, default: 0)
+         *
+         * Example:
+         *
+         *     "checkerboard" : {
+         *       "cutoff" : 10, "salt" : {}, "water" : { "dp":0.5, "dprot":0.5 }
+         *     }
+         */
+        template<class Tspace>
+        class CheckerboardSweep : public Movebase<Tspace>
+        {
+        private:
+            typedef Movebase<Tspace> base;
+            using base::spc;
+            using base::pot;
+            using base::w;
+
+            struct Unit
+            {
+                Group *g;  // group of the unit
+                int i;     // particle index if atomic, otherwise -1
+            };
+
+            double cutoff;            // interaction range
+            int n[3];                 // number of domains in each direction
+            Point len, h, offset;     // box and domain side lengths and grid offset
+            vector<Unit> units;       // all movable units
+            vector<int> owner;        // domain of the unit owning each particle (-1 if static)
+            Average<double> domains;  // number of domains per sweep
+            unsigned long int trials, accepted; // number of single trials and accepted ones
+
+            void _trialMove() override { assert(1 == 2); }
+
+            void _acceptMove() override { assert(1 == 2); }
+
+            void _rejectMove() override { assert(1 == 2); }
+
+            double _energyChange() override
+            {
+                assert(1 == 2);
+                return 0;
+            }
+
+            int domain( const Point &a ) const
+            {
+                int c[3];
+                for ( int d = 0; d < 3; d++ )
+                {
+                    c[d] = int(std::floor((a[d] + 0.5 * len[d] - offset[d]) / h[d]));
+                    c[d] = (c[d] % n[d] + n[d]) % n[d];
+                }
+                return c[0] + n[0] * (c[1] + n[1] * c[2]);
+            }
+
+            int colour( int dom ) const
+            {
+                int c = 0, bit = 1;
+                for ( int d = 0; d < 3; d++ )
+                {
+                    if ( n[d] > 1 )
+                    {
+                        if ( dom % n[d] % 2 )
+                            c += bit;
+                        bit *= 2;
+                    }
+                    dom /= n[d];
+                }
+                return c;
+            }
+
+            /** @brief Unique domains in the 3x3x3 neighbourhood of `dom`, including itself */
+            vector<int> neighbours( int dom ) const
+            {
+                int c[3] = {dom % n[0], dom / n[0] % n[1], dom / (n[0] * n[1])};
+                vector<int> v;
+                for ( int i = -1; i <= 1; i++ )
+                    for ( int j = -1; j <= 1; j++ )
+                        for ( int k = -1; k <= 1; k++ )
+                            v.push_back((c[0] + i + n[0]) % n[0]
+                                            + n[0] * ((c[1] + j + n[1]) % n[1] + n[1] * ((c[2] + k + n[2]) % n[2])));
+                std::sort(v.begin(), v.end());
+                v.erase(std::unique(v.begin(), v.end()), v.end());
+                return v;
+            }
+
+            Point anchor( const typename Tspace::ParticleVector &p, const Unit &u ) const
+            {
+                return (u.i < 0) ? ((&p == &spc->p) ? u.g->cm : u.g->cm_trial) : Point(p[u.i]);
+            }
+
+            /** @brief Energy change of moved unit with particles in `near` */
+            double energyChange( const Unit &u, const vector<int> &near )
+            {
+                double du = 0;
+                auto pair = [&]( int i )
+                {
+                    for ( auto j : near )
+                        if ( j != i && !(u.i < 0 && u.g->find(j)))
+                            du += pot->i2i(spc->trial, i, j) - pot->i2i(spc->p, i, j);
+                };
+                if ( u.i < 0 )
+                {
+                    for ( auto i : *u.g )
+                        if ( spc->geo.collision(spc->trial[i], spc->trial[i].radius) )
+                            return pc::infty;
+                    du += pot->g_external(spc->trial, *u.g) - pot->g_external(spc->p, *u.g);
+                    for ( auto i : *u.g )
+                        pair(i);
+                }
+                else
+                {
+                    if ( spc->geo.collision(spc->trial[u.i], spc->trial[u.i].radius) )
+                        return pc::infty;
+                    du += pot->i_external(spc->trial, u.i) - pot->i_external(spc->p, u.i);
+                    pair(u.i);
+                }
+                return du;
+            }
+
+            /** @brief Random displacement of unit in trial vector */
+            template<class Trandom>
+            void displace( const Unit &u, Trandom &ran )
+            {
+                if ( u.i >= 0 )
+                {
+                    Point t = Point(1, 1, 1) * atom[spc->p[u.i].id].dp;
+                    for ( int d = 0; d < 3; d++ )
+                        t[d] *= ran() - 0.5;
+                    spc->trial[u.i].translate(spc->geo, t);
+                    return;
+                }
+                auto &m = this->mollist[u.g->molId];
+                if ( m.dp2 > 1e-6 )
+                {
+                    Point a;
+                    a.ranunit(ran);
+                    Geometry::QuaternionRotate vrot1;
+                    vrot1.setAxis(spc->geo, u.g->cm, u.g->cm + a, m.dp2 * (ran() - 0.5));
+                    auto vrot2 = vrot1;
+                    vrot2.getOrigin() = Point(0, 0, 0);
+                    for ( auto i : *u.g )
+                    {
+                        spc->trial[i] = vrot1(spc->trial[i]);
+                        spc->trial[i].rotate(vrot2);
+                    }
+                }
+                if ( m.dp1 > 1e-6 )
+                {
+                    Point t = m.dir * m.dp1;
+                    for ( int d = 0; d < 3; d++ )
+                        t[d] *= ran() - 0.5;
+                    u.g->cm_trial.translate(spc->geo, t);
+                    for ( auto i : *u.g )
+                        spc->trial[i].translate(spc->geo, t);
+                }
+            }
+
+            /** @brief Set domain grid with random offset for current box and molecules */
+            void setDomains()
+            {
+                len = dynamic_cast<Geometry::Cuboid &>(spc->geo).len;
+                double rmax = 0; // largest distance between a particle and its mass center
+                for ( auto &u : units )
+                    if ( u.i < 0 )
+                        for ( auto i : *u.g )
+                            rmax = std::max(rmax, spc->geo.dist(spc->p[i], u.g->cm));
+                for ( int d = 0; d < 3; d++ )
+                {
+                    n[d] = 2 * int(len[d] / (2 * (cutoff + 2 * rmax)));
+                    if ( n[d] < 2 )
+                        n[d] = 1;
+                    h[d] = len[d] / n[d];
+                    offset[d] = slump() * h[d];
+                }
+            }
+
+            string _info() override
+            {
+                using namespace textio;
+                std::ostringstream o;
+                o << pad(SUB, w, "Cutoff") << cutoff << _angstrom << endl
+                  << pad(SUB, w, "Movable units") << units.size() << endl;
+                if ( domains.cnt > 0 )
+                    o << pad(SUB, w, "Domains") << domains.avg() << endl
+                      << pad(SUB, w, "Single trials") << trials << endl
+                      << pad(SUB, w, "Single trial acceptance") << double(accepted) / trials * 100 << percent << endl;
+                return o.str();
+            }
+
+            Tmjson _json() override
+            {
+                Tmjson j;
+                if ( domains.cnt > 0 )
+                    j[base::title] = {
+                        {"cutoff", cutoff},
+                        {"domains", domains.avg()},
+                        {"single trials", trials},
+                        {"single trial acceptance", double(accepted) / trials}
+                    };
+                return j;
+            }
+
+        public:
+            CheckerboardSweep( Energy::Energybase<Tspace> &e, Tspace &s, Tmjson &j ) : base(e, s), trials(0), accepted(0)
+            {
+                base::title = "Checkerboard Sweep";
+                base::runfraction = j.value("prob", 1.0);
+                cutoff = j.at("cutoff");
+                if ( !std::is_base_of<Geometry::Cuboid, typename Tspace::GeometryType>::value )
+                    throw std::runtime_error(base::title + ": Cuboid geometry required");
+                base::fillMolList(j);
+                for ( auto &i : this->mollist )
+                {
+                    string molname = spc->molList()[i.first].name;
+                    i.second.dp1 = j[molname].value("dp", 0.0);
+                    i.second.dp2 = j[molname].value("dprot", 0.0);
+                }
+                if ( this->mollist.empty())
+                    throw std::runtime_error(base::title + ": no molecules to move");
+            }
+
+            /**
+             * @brief Perform `n` sweeps
+             * @return Energy change (kT)
+             */
+            double move( int sweeps = 1 ) override
+            {
+                double utot = 0;
+                if ( !base::run())
+                    return utot;
+                auto &p = spc->p;
+                auto &trial = spc->trial;
+                while ( sweeps-- > 0 )
+                {
+                    base::cnt++;
+                    if ( base::cnt == 1 )
+                        for ( auto g : spc->groupList())
+                            g->setMassCenter(*spc);
+
+                    units.clear();
+                    for ( auto &m : this->mollist )
+                        for ( auto g : spc->molecules(m.first))
+                            if ( g->isAtomic())
+                            {
+                                for ( auto i : *g )
+                                    units.push_back({g, i});
+                            }
+                            else
+                                units.push_back({g, -1});
+
+                    setDomains();
+                    int ndom = n[0] * n[1] * n[2];
+                    domains += ndom;
+                    vector<int> order(1 << ((n[0] > 1) + (n[1] > 1) + (n[2] > 1)));
+                    std::iota(order.begin(), order.end(), 0);
+                    std::shuffle(order.begin(), order.end(), slump.eng);
+
+                    for ( auto c : order )
+                    {
+                        // distribute particles and units onto domains
+                        vector<vector<int>> plist(ndom), ulist(ndom);
+                        owner.assign(p.size(), -1);
+                        for ( size_t k = 0; k < units.size(); k++ )
+                        {
+                            int dom = domain(anchor(p, units[k]));
+                            ulist[dom].push_back(k);
+                            if ( units[k].i < 0 )
+                                for ( auto i : *units[k].g )
+                                    owner[i] = dom;
+                            else
+                                owner[units[k].i] = dom;
+                        }
+                        for ( size_t i = 0; i < p.size(); i++ )
+                            plist[domain(p[i])].push_back(i);
+
+                        vector<int> active;
+                        vector<unsigned int> seeds;
+                        for ( int dom = 0; dom < ndom; dom++ )
+                            if ( colour(dom) == c && !ulist[dom].empty())
+                            {
+                                active.push_back(dom);
+                                seeds.push_back(slump.eng());
+                            }
+
+                        double du = 0;
+                        int cnt = 0, acc = 0;
+#pragma omp parallel for schedule (dynamic) reduction (+:du,acc,cnt)
+                        for ( int a = 0; a < (int) active.size(); a++ )
+                        {
+                            int dom = active[a];
+                            std::mt19937 eng(seeds[a]);
+                            std::uniform_real_distribution<double> dist(0, 1);
+                            auto ran = [&]() { return dist(eng); };
+
+                            // particles that may interact with units in `dom`,
+                            // skipping those owned by other active domains
+                            vector<int> near;
+                            for ( auto d : neighbours(dom))
+                                for ( auto j : plist[d] )
+                                    if ( owner[j] < 0 || owner[j] == dom || colour(owner[j]) != c )
+                                        near.push_back(j);
+
+                            auto &ul = ulist[dom];
+                            for ( size_t t = 0; t < ul.size(); t++ )
+                            {
+                                auto &u = units[ul[std::min(size_t(ran() * ul.size()), ul.size() - 1)]];
+                                displace(u, ran);
+                                double dui = pc::infty;
+                                if ( domain(anchor(trial, u)) == dom )
+                                    dui = energyChange(u, near);
+                                cnt++;
+                                if ( ran() < std::exp(-dui))
+                                {
+                                    du += dui;
+                                    acc++;
+                                    if ( u.i < 0 )
+                                    {
+                                        for ( auto i : *u.g )
+                                            p[i] = trial[i];
+                                        u.g->cm = u.g->cm_trial;
+                                    }
+                                    else
+                                        p[u.i] = trial[u.i];
+                                }
+                                else if ( u.i < 0 )
+                                {
+                                    for ( auto i : *u.g )
+                                        trial[i] = p[i];
+                                    u.g->cm_trial = u.g->cm;
+                                }
+                                else
+                                    trial[u.i] = p[u.i];
+                            }
+                        }
+                        utot += du;
+                        trials += cnt;
+                        accepted += acc;
+                        base::acceptedMoves() += acc; // bypasses `acceptMove()`
+                    }
+                }
+                assert(spc->p == spc->trial && "Trial particle vector out of sync!");
+                return utot;
+            }
+        };
+
         /**
          * @brief Crank shaft move of linear polymers
          *
@@ -2266,7 +3540,7 @@
 
             if ( !this->mollist.empty())
             {
-                auto gvec = spc->findMolecules(this->currentMolId);
+                auto &gvec = spc->molecules(this->currentMolId);
                 assert(!gvec.empty());
                 gPtr = *slump.element(gvec.begin(), gvec.end());
                 assert(!gPtr->empty());
@@ -2315,7 +3589,8 @@
         }
 
         /**
-         * @todo g_internal is not really needed - index<->g would be faster
+         * The internal energy change involves only the rotated particles,
+         * see `Energy::Energybase::g_internal_subset()`.
          */
         template<class Tspace>
         double CrankShaft<Tspace>::_energyChange()
@@ -2445,6 +3720,17 @@
          * :------------ | :---------------------------------------------------------------------------
          * `prob`        | Probability to perform a move (defaults=1)
          * `bondlength`  | The bond length while moving head groups. Use -1 to use existing bondlength.
+         * `localcheck`  | Compare local internal energy change with full evaluation every n'th move (default=100)
+         *
+         * For chains where all monomers have the same atom type and charge,
+         * a reptation is equivalent to moving one end monomer to the other end
+         * followed by relabelling. The internal energy change is then obtained
+         * from the terms involving the new and the removed end monomer only,
+         * see `Energy::Energybase::g_internal_subset()`, which is
+         * \f$\mathcal{O}(N)\f$ rather than \f$\mathcal{O}(N^2)\f$.
+         * This assumes that also bonds and exclusions are uniform along the
+         * chain. The local scheme is regularly compared with a full evaluation
+         * and disabled for the molecule should they disagree.
          *
          * @date Lund 2012
          */
@@ -2462,6 +3748,11 @@
             string _info() override;
             Group *gPtr;
             double bondlength; //!< Reptation length used when generating new head group position
+            int head;          //!< Index of new end point
+            int tail;          //!< Index of end point removed by the move
+            std::map<int, int> localcheck; //!< Molecule id -> compare local and full energy change every n'th move
+            std::map<int, bool> local; //!< Molecule id -> use local internal energy change
+            bool isUniform( const Group & ) const;
         protected:
             using base::pot;
             using base::spc;
@@ -2484,9 +3775,20 @@
             { // loop over molecules to be moved
                 string molname = spc->molList()[i.first].name;
                 i.second.dp1 = m[molname]["bondlength"] | -1.0;
+                localcheck[i.first] = m[molname].value("localcheck", 100);
             }
         }
 
+        /** @brief True if all particles in group have the same atom type and charge */
+        template<class Tspace>
+        bool Reptation<Tspace>::isUniform( const Group &g ) const
+        {
+            for ( auto i : g )
+                if ( spc->p[i].id != spc->p[g.front()].id || spc->p[i].charge != spc->p[g.front()].charge )
+                    return false;
+            return true;
+        }
+
         template<class Tspace>
         void Reptation<Tspace>::_test( UnitTest &t )
         {
@@ -2500,7 +3802,7 @@
             gPtr = nullptr;
             if ( !this->mollist.empty())
             {
-                auto gvec = spc->findMolecules(this->currentMolId);
+                auto &gvec = spc->molecules(this->currentMolId);
                 if ( !gvec.empty())
                 {
                     gPtr = *slump.element(gvec.begin(), gvec.end());
@@ -2548,6 +3850,9 @@
                 spc->geo.boundary(spc->trial[i]);  // respect boundary conditions
 
             gPtr->cm_trial = Geometry::massCenter(spc->geo, spc->trial, *gPtr);
+
+            head = first;
+            tail = (first == gPtr->front()) ? gPtr->back() : gPtr->front();
         }
 
         template<class Tspace>
@@ -2571,10 +3876,39 @@
                 if ( spc->geo.collision(spc->trial[i], spc->trial[i].radius, Geometry::Geometrybase::BOUNDARY))
                     return pc::infty;
 
-            double unew = pot->g_external(spc->trial, *gPtr) + pot->g_internal(spc->trial, *gPtr);
+            auto it = local.find(gPtr->molId);
+            if ( it == local.end())
+                it = local.insert({gPtr->molId, isUniform(*gPtr)}).first;
+
+            double unew = pot->g_external(spc->trial, *gPtr);
+            double uold = pot->g_external(spc->p, *gPtr);
+            if ( it->second )
+            {
+                // only the end points differ after relabelling
+                double dulocal = pot->g_internal_subset(spc->trial, *gPtr, {head})
+                    - pot->g_internal_subset(spc->p, *gPtr, {tail});
+                int n = localcheck[gPtr->molId];
+                if ( n > 0 && (base::cnt - 1) % n == 0 )
+                {
+                    double dufull = pot->g_internal(spc->trial, *gPtr) - pot->g_internal(spc->p, *gPtr);
+                    if ( std::isfinite(dufull) && std::fabs(dulocal - dufull) > 1e-6 * (1 + std::fabs(dufull)))
+                    {
+                        std::cerr << base::title << ": local energy change (" << dulocal
+                                  << " kT) differs from full evaluation (" << dufull << " kT) - "
+                                  << gPtr->name << " is not uniform; local scheme disabled." << endl;
+                        it->second = false;
+                        dulocal = dufull;
+                    }
+                }
+                unew += dulocal;
+            }
+            else
+            {
+                unew += pot->g_internal(spc->trial, *gPtr);
+                uold += pot->g_internal(spc->p, *gPtr);
+            }
             if ( unew == pc::infty )
                 return pc::infty;       // early rejection
-            double uold = pot->g_external(spc->p, *gPtr) + pot->g_internal(spc->p, *gPtr);
 
             for ( auto g : spc->groupList())
             {
@@ -2595,11 +3929,448 @@
             using namespace textio;
             std::ostringstream o;
             o << pad(SUB, base::w, "Bondlength") << bondlength << _angstrom + " (-1 = automatic)\n";
+            for ( auto &i : local )
+                o << pad(SUB, base::w, "Local energy change") << spc->molList()[i.first].name
+                  << ": " << std::boolalpha << i.second << endl;
             if ( base::cnt > 0 )
                 o << accmap.info();
             return o.str();
         }
 
+        /**
+         * @brief Configurational-bias (Rosenbluth) growth of flexible molecules
+         *
+         * Molecules are grown bead by bead along the bond graph given in the
+         * molecule definition (`MoleculeData::bonds`), starting from either the
+         * first or the last particle. For each bead `k` trial positions are
+         * generated and one is picked according to its Boltzmann weight,
+         * \f$w_j = e^{-\beta u_j}\f$, where \f$u_j\f$ is the energy of the bead with
+         * the rest of the system (`all2p()` and `p_external()`), with already
+         * grown beads (`p2p()`) and with bonded partners, except the partner
+         * used to generate its position. The Rosenbluth factor
+         * \f$W=\prod_i \frac{1}{k}\sum_j w_{ij}\f$ is returned by `grow()`.
+         * Bond lengths are drawn from the ideal (harmonic) bond length distribution
+         * and directions are isotropic so that the reference state is an ideal
+         * chain with only bonded interactions. The first bead, if not kept,
+         * is placed uniformly in the container.
+         *
+         * `uinter` and `uintra` hold the energy of the selected beads with the
+         * system and within the molecule, respectively. Moves using this class
+         * should correct for any difference between these and the full Hamiltonian
+         * so that the latter is sampled exactly, see `Regrowth`.
+         *
+         * Particles listed in `exclude`, i.e. the molecule itself, are skipped
+         * when summing `p2p()` over the system so that no copy of the particle
+         * vector is made.
+         *
+         * @note Only harmonic bonds are supported and every bead must be connected
+         *       to the first (or last) bead via bonds. For other molecules,
+         *       `growable()` is false and `reason()` tells why.
+         */
+        template<class Tspace>
+        class RosenbluthGrowth
+        {
+        private:
+            typedef typename Tspace::ParticleVector Tpvec;
+            typedef typename Tspace::ParticleType Tparticle;
+
+            /** @brief Tabulated ideal bond length distribution, \f$r^2 e^{-\beta u(r)}\f$ */
+            struct BondTable
+            {
+                Potential::Harmonic bond;
+                double dr, Z;
+                std::vector<double> cdf;
+
+                double f( double r ) const { return r * r * std::exp(-bond.k * (r - bond.req) * (r - bond.req)); }
+
+                BondTable( const Potential::Harmonic &b ) : bond(b), Z(0)
+                {
+                    if ( bond.k <= 0 )
+                        throw std::runtime_error("Rosenbluth growth requires positive bond force constants");
+                    const int n = 1000;
+                    dr = (bond.req + 10 / std::sqrt(bond.k)) / n;
+                    cdf.resize(n);
+                    for ( int i = 0; i < n; i++ )
+                        cdf[i] = (Z += f((i + 0.5) * dr) * dr);
+                }
+
+                /** @brief Random bond length and ratio between ideal and proposal probability */
+                double sample( double &g ) const
+                {
+                    size_t b = std::lower_bound(cdf.begin(), cdf.end(), slump() * Z) - cdf.begin();
+                    b = std::min(b, cdf.size() - 1);
+                    double r = (b + slump()) * dr;
+                    g = ratio(r);
+                    return r;
+                }
+
+                /** @brief Ratio between ideal and proposal probability for bond length `r` */
+                double ratio( double r ) const
+                {
+                    size_t b = size_t(r / dr);
+                    if ( b >= cdf.size())
+                        return pc::infty;
+                    double q = (b == 0) ? cdf[0] : cdf[b] - cdf[b - 1]; // proposal probability of bin
+                    return f(r) * dr / q;
+                }
+            };
+
+            /** @brief Growth order and bonds of a molecule */
+            struct Topology
+            {
+                std::vector<int> order;   // growth order
+                std::vector<int> parent;  // bond partner used to generate position (-1 for first)
+                std::vector<std::vector<std::pair<int, Potential::Harmonic>>> bonds; // bonds of each bead
+            };
+
+            Tspace *spc;
+            Energy::Energybase<Tspace> *pot;
+            std::map<int, std::array<Topology, 2>> topo; // molecule id -> growth from front or back
+            std::map<int, string> _reason;               // molecule id -> why it cannot be grown ("" if it can)
+            std::map<std::pair<double, double>, BondTable> tables;
+            std::vector<char> skip;                      // particles in `Space::p` to ignore (excluded)
+
+            Topology makeTopology( int molid, bool reverse )
+            {
+                auto &mol = spc->molecule[molid];
+                int n = mol.atoms.size();
+                Topology t;
+                t.parent.resize(n, -1);
+                t.bonds.resize(n);
+                for ( auto &b : mol.getBondList())
+                {
+                    int i = b.index.at(0), j = b.index.at(1);
+                    if ( b.type != Bonded::BondData::Type::HARMONIC )
+                        throw std::runtime_error("only harmonic bonds are supported");
+                    if ( i < 0 || j < 0 || i >= n || j >= n )
+                        throw std::runtime_error("bond index out of range");
+                    t.bonds[i].push_back({j, Potential::Harmonic(b.k, b.req)});
+                    t.bonds[j].push_back({i, Potential::Harmonic(b.k, b.req)});
+                }
+                std::vector<char> seen(n, 0);
+                int root = reverse ? n - 1 : 0;
+                t.order.push_back(root);
+                seen[root] = 1;
+                for ( size_t m = 0; m < t.order.size(); m++ )  // breadth first
+                    for ( auto &b : t.bonds[t.order[m]] )
+                        if ( !seen[b.first] )
+                        {
+                            seen[b.first] = 1;
+                            t.parent[b.first] = t.order[m];
+                            t.order.push_back(b.first);
+                        }
+                return t;
+            }
+
+            BondTable &table( const Potential::Harmonic &b )
+            {
+                auto key = std::make_pair(b.k, b.req);
+                auto it = tables.find(key);
+                if ( it == tables.end())
+                    it = tables.insert({key, BondTable(b)}).first;
+                return it->second;
+            }
+
+        public:
+            double uinter; //!< Energy of grown beads with the system (kT)
+            double uintra; //!< Energy of grown beads within the molecule, incl. bonds (kT)
+
+            RosenbluthGrowth( Tspace &s, Energy::Energybase<Tspace> &e ) : spc(&s), pot(&e), uinter(0), uintra(0) {}
+
+            /** @brief Why molecule cannot be grown; empty if it can */
+            const string &reason( int molid )
+            {
+                auto it = _reason.find(molid);
+                if ( it != _reason.end())
+                    return it->second;
+                string r;
+                auto &mol = spc->molecule[molid];
+                if ( !mol.isMolecular() || mol.atoms.size() < 2 || mol.getBondList().empty())
+                    r = "no bonds";
+                else
+                {
+                    try
+                    {
+                        if ( makeTopology(molid, false).order.size() != mol.atoms.size())
+                            r = "not all particles connected by bonds";
+                    }
+                    catch ( std::exception &e )
+                    {
+                        r = e.what();
+                    }
+                }
+                return _reason[molid] = r;
+            }
+
+            /** @brief True if molecule is connected by harmonic bonds and can be grown */
+            bool growable( int molid ) { return reason(molid).empty(); }
+
+            /** @brief Particle index of molecule in growth order (`dir`=0 from front, 1 from back) */
+            const std::vector<int> &order( int molid, int dir )
+            {
+                auto it = topo.find(molid);
+                if ( it == topo.end())
+                {
+                    if ( !growable(molid))
+                        throw std::runtime_error("Molecule " + spc->molecule[molid].name
+                                                 + " cannot be grown: " + reason(molid));
+                    it = topo.insert({molid, {{makeTopology(molid, false), makeTopology(molid, true)}}}).first;
+                }
+                return it->second.at(dir).order;
+            }
+
+            /**
+             * @brief Grow molecule and return the logarithm of the Rosenbluth factor
+             * @param v Particles of molecule; grown positions are written here
+             * @param molid Molecule id
+             * @param exclude Index of particles in `Space::p` to ignore, i.e. the molecule itself
+             * @param nkeep Number of beads, in growth order, to keep at their current position
+             * @param dir Grow from front (0) or back (1)
+             * @param k Number of trial positions per bead
+             * @param retrace If true, the current positions are used as first trial
+             *                (Rosenbluth factor of an existing configuration)
+             * @return \f$\ln W\f$; `-infinity` if all trials for a bead were rejected
+             */
+            double grow( Tpvec &v, int molid, const std::vector<int> &exclude,
+                         int nkeep, int dir, int k, bool retrace )
+            {
+                order(molid, dir);
+                auto &t = topo[molid][dir];
+                assert(v.size() == t.order.size());
+
+                const Tpvec &p = spc->p;
+                skip.resize(p.size(), 0);
+                for ( auto i : exclude )
+                    skip.at(i) = 1;
+
+                std::vector<char> placed(v.size(), 0);
+                for ( int m = 0; m < nkeep; m++ )
+                    placed[t.order[m]] = 1;
+
+                std::vector<Tparticle> trial(k);
+                std::vector<double> ui(k), ub(k), up(k), lnw(k);
+                double lnW = 0;
+                uinter = uintra = 0;
+                for ( size_t m = nkeep; m < t.order.size(); m++ )
+                {
+                    int i = t.order[m], parent = t.parent[i];
+                    double lnwmax = -pc::infty;
+                    for ( int j = 0; j < k; j++ )
+                    {
+                        double g = 1; // ideal/proposal probability ratio
+                        trial[j] = v[i];
+                        if ( !(retrace && j == 0))
+                        {
+                            if ( parent < 0 )
+                                spc->geo.randompos(trial[j]);
+                            else
+                            {
+                                Potential::Harmonic *b = nullptr;
+                                for ( auto &bond : t.bonds[i] )
+                                    if ( bond.first == parent )
+                                        b = &bond.second;
+                                Point u;
+                                u.ranunit(slump);
+                                trial[j] = Point(v[parent] + u * table(*b).sample(g));
+                                spc->geo.boundary(trial[j]);
+                            }
+                        }
+                        else if ( parent >= 0 )
+                            for ( auto &bond : t.bonds[i] )
+                                if ( bond.first == parent )
+                                    g = table(bond.second).ratio(spc->geo.dist(v[parent], v[i]));
+
+                        ui[j] = ub[j] = up[j] = 0;
+                        if ( spc->geo.collision(trial[j], trial[j].radius))
+                            ui[j] = pc::infty;
+                        else
+                        {
+                            for ( auto &bond : t.bonds[i] )
+                                if ( placed[bond.first] )
+                                {
+                                    double u = bond.second(trial[j], v[bond.first],
+                                                           spc->geo.sqdist(trial[j], v[bond.first]));
+                                    if ( bond.first == parent )
+                                        up[j] = u; // sampled, i.e. not part of weight
+                                    else
+                                        ub[j] += u;
+                                }
+                            for ( size_t l = 0; l < v.size(); l++ )
+                                if ( placed[l] )
+                                    ub[j] += pot->p2p(trial[j], v[l]);
+                            if ( exclude.empty())
+                                ui[j] = pot->all2p(p, trial[j]);
+                            else
+                                for ( size_t l = 0; l < p.size(); l++ )
+                                    if ( !skip[l] )
+                                        ui[j] += pot->p2p(trial[j], p[l]);
+                            ui[j] += pot->p_external(trial[j]);
+                        }
+                        lnw[j] = std::log(g) - ui[j] - ub[j];
+                        if ( std::isnan(lnw[j]))
+                            lnw[j] = -pc::infty;
+                        lnwmax = std::max(lnwmax, lnw[j]);
+                    }
+                    if ( lnwmax == -pc::infty || lnwmax == pc::infty )
+                    {
+                        for ( auto l : exclude )
+                            skip[l] = 0;
+                        return lnwmax;      // all trials rejected or (retrace) configuration cannot be generated
+                    }
+
+                    double sum = 0;
+                    for ( int j = 0; j < k; j++ )
+                        sum += std::exp(lnw[j] - lnwmax);
+                    lnW += lnwmax + std::log(sum / k);
+
+                    int s = 0; // selected trial
+                    if ( !retrace )
+                    {
+                        double r = slump() * sum;
+                        for ( s = 0; s < k - 1; s++ )
+                            if ( (r -= std::exp(lnw[s] - lnwmax)) < 0 )
+                                break;
+                    }
+                    v[i] = trial[s];
+                    placed[i] = 1;
+                    uinter += ui[s];
+                    uintra += ub[s] + up[s];
+                }
+                for ( auto l : exclude )
+                    skip[l] = 0;
+                return lnW;
+            }
+        };
+
+        /**
+         * @brief Configurational-bias regrowth of flexible molecules
+         *
+         * A random number of beads at one end of a molecule is regrown using
+         * `RosenbluthGrowth`; with `maxlen` equal to the molecule size the whole
+         * molecule may be removed and regrown at a random position.
+         * The move is accepted with probability
+         * \f$\min\left(1, \frac{W_{new}}{W_{old}} e^{-\beta(\Delta U-\Delta U_{cbmc})}\right)\f$
+         * where \f$\Delta U\f$ is the energy change of the full Hamiltonian and
+         * \f$\Delta U_{cbmc}\f$ is the energy change seen by the growth, which
+         * guarantees exact sampling even if the two differ, for example for
+         * cut-offs, exclusions or group based external potentials.
+         *
+         * The following keywords are read from the `moves/regrow` section for
+         * each molecule:
+         *
+         * Key       | Description
+         * :-------- | :---------------------------------------------------------
+         * `ktrial`  | Number of trial positions per bead (default: 10)
+         * `maxlen`  | Maximum number of beads to regrow (default: all)
+         * `prob`    | Probability to perform a move (default: 1)
+         *
+         * Bonds are taken from the molecule definition and should match those
+         * of `Energy::Bonded`. Only harmonic bonds are supported and an exception
+         * is thrown for other molecules.
+         */
+        template<class Tspace>
+        class Regrowth : public Movebase<Tspace>
+        {
+        private:
+            typedef Movebase<Tspace> base;
+            typedef typename Tspace::ParticleVector Tpvec;
+            using base::spc;
+            using base::pot;
+            RosenbluthGrowth<Tspace> cbmc;
+            AcceptanceMap<string> accmap;
+            std::map<int, int> _ktrial, _maxlen;
+            Group *gPtr;
+            double lnWnew, lnWold, ucbmc; // Rosenbluth factors and energy change seen by growth
+
+            void _test( UnitTest &t ) override
+            {
+                accmap._test(t, textio::trim(base::title));
+            }
+
+            void _trialMove() override
+            {
+                auto &gvec = spc->molecules(this->currentMolId);
+                assert(!gvec.empty());
+                gPtr = *slump.element(gvec.begin(), gvec.end());
+                int n = gPtr->size();
+                int len = std::min(n, _maxlen[this->currentMolId]);
+                int nkeep = n - slump.range(1, len);
+                int dir = slump.range(0, 1);
+                int k = _ktrial[this->currentMolId];
+
+                std::vector<int> exclude(gPtr->begin(), gPtr->end());
+                Tpvec v(spc->p.begin() + gPtr->front(), spc->p.begin() + gPtr->back() + 1);
+                lnWold = cbmc.grow(v, gPtr->molId, exclude, nkeep, dir, k, true);
+                ucbmc = -cbmc.uinter - cbmc.uintra;
+                lnWnew = cbmc.grow(v, gPtr->molId, exclude, nkeep, dir, k, false);
+                ucbmc += cbmc.uinter + cbmc.uintra;
+
+                int gindex = spc->findIndex(gPtr);
+                auto &order = cbmc.order(gPtr->molId, dir);
+                for ( size_t m = nkeep; m < order.size(); m++ )
+                {
+                    int i = gPtr->front() + order[m];
+                    spc->trial[i] = v[order[m]];
+                    base::change.mvGroup[gindex].push_back(i);
+                }
+                gPtr->cm_trial = Geometry::massCenter(spc->geo, spc->trial, *gPtr);
+            }
+
+            double _energyChange() override
+            {
+                base::alternateReturnEnergy = 0;
+                if ( lnWnew == -pc::infty || lnWold == pc::infty )
+                    return pc::infty;
+                double du = Energy::energyChange(*spc, *pot, base::change);
+                base::alternateReturnEnergy = du;
+                return du - ucbmc - (lnWnew - lnWold);
+            }
+
+            void _acceptMove() override
+            {
+                accmap.accept(gPtr->name, spc->geo.sqdist(gPtr->cm, gPtr->cm_trial));
+                gPtr->accept(*spc);
+            }
+
+            void _rejectMove() override
+            {
+                accmap.reject(gPtr->name);
+                gPtr->undo(*spc);
+            }
+
+            string _info() override
+            {
+                using namespace textio;
+                std::ostringstream o;
+                for ( auto &i : _ktrial )
+                    o << pad(SUB, base::w, "Trials/max. length") << spc->molList()[i.first].name << ": "
+                      << i.second << " " << _maxlen[i.first] << endl;
+                if ( base::cnt > 0 )
+                    o << accmap.info();
+                return o.str();
+            }
+
+        public:
+            Regrowth( Energy::Energybase<Tspace> &e, Tspace &s, Tmjson &j ) : base(e, s), cbmc(s, e), gPtr(nullptr)
+            {
+                base::title = "Configurational-Bias Regrowth";
+                base::useAlternativeReturnEnergy = true;
+                auto m = j;
+                base::fillMolList(m);
+                for ( auto &i : this->mollist )
+                {
+                    auto &mol = spc->molList()[i.first];
+                    if ( !cbmc.growable(i.first))
+                        throw std::runtime_error(base::title + ": molecule " + mol.name + " cannot be grown: "
+                                                 + cbmc.reason(i.first));
+                    _ktrial[i.first] = m[mol.name].value("ktrial", 10);
+                    _maxlen[i.first] = m[mol.name].value("maxlen", int(mol.atoms.size()));
+                    if ( _ktrial[i.first] < 1 || _maxlen[i.first] < 1 )
+                        throw std::runtime_error(base::title + ": ktrial and maxlen must be positive");
+                }
+            }
+        };
+
         /**
          * @brief Isobaric volume move
          *
@@ -2613,10 +4384,19 @@
          * `dV`    | Volume displacement parameter
          * `P`     | Pressure [mM]
          * `prob`  | Runfraction [default=1]
+         * `scalecheck` | Compare analytic energy change with full evaluation every n'th move [default=100]
          *
          * Note that new volumes are generated according to
          * \f$ V^{\prime} = \exp\left ( \log V \pm \delta dp \right ) \f$
          * where \f$\delta\f$ is a random number between zero and one half.
+         *
+         * If the Hamiltonian consists only of a single term derived from
+         * `Energy::IsotropicScaling`, for example `Energy::NonbondedScaling`, and
+         * `Energy::ExternalPressure`, and the geometry is a `Cuboid`, the non-bonded
+         * energy change is obtained analytically and only `external()` and
+         * `g_external()` are evaluated for the pressure term. Any other energy
+         * term disables the analytic scheme. The result is regularly compared
+         * with a full evaluation and the analytic scheme is disabled if they disagree.
          */
         template<class Tspace>
         class Isobaric : public Movebase<Tspace>
@@ -2635,6 +4415,8 @@
             using base::pot;
             using base::w;
             using base::change;
+            Energy::IsotropicScaling *scaling; //!< Energy term with analytic scaling; `nullptr` if none
+            int scalecheck; //!< Compare analytic and full energy change every n'th move
             double P; //!< Pressure
             double dp; //!< Volume displacement parameter
             double oldval;
@@ -2651,12 +4433,13 @@
 
         template<class Tspace>
         template<class Tenergy> Isobaric<Tspace>::Isobaric(
-            Tenergy &e, Tspace &s, Tmjson &j ) : base(e, s)
+            Tenergy &e, Tspace &s, Tmjson &j ) : base(e, s), scaling(nullptr)
         {
 
             this->title = "Isobaric Volume Fluctuations";
             this->w = 30;
             dp = j.at("dp");
+            scalecheck = j.value("scalecheck", 100);
             P = j.at("pressure").get<double>() * 1.0_mM;
             base::runfraction = j.value("prob", 1.0);
             if ( dp < 1e-6 )
@@ -2668,6 +4451,17 @@
                 (*ptr)->setPressure(P);
             else
                 throw std::runtime_error(base::title+": pressure term required in hamiltonian");
+
+            // the analytic volume change covers only the scaling term and is
+            // therefore used only if all other terms are external
+            if ( std::is_same<typename Tspace::GeometryType, Geometry::Cuboid>::value
+                || std::is_same<typename Tspace::GeometryType, Geometry::Cube>::value )
+            {
+                size_t nscale = TupleFindType::countBase<Energy::IsotropicScaling>(t);
+                size_t nexternal = TupleFindType::countBase<Energy::ExternalPressure<Tspace>>(t);
+                if ( nscale == 1 && nscale + nexternal == std::tuple_size<decltype(t)>::value )
+                    scaling = TupleFindType::getBase<Energy::IsotropicScaling>(t);
+            }
             //auto ptr = e.template get<Energy::ExternalPressure<Tspace>>();
             //if ( ptr != nullptr )
             //    ptr->setPressure(P);
@@ -2692,7 +4486,8 @@
               << N << " (" << Nmol << " molecular + " << Natom << " atomic)\n"
               << pad(SUB, w, "Pressure")
               << P / 1.0_mM << " mM = " << P / 1.0_Pa << " Pa = " << P / 1.0_atm << " atm\n"
-              << pad(SUB, w, "Temperature") << pc::T() << " K\n";
+              << pad(SUB, w, "Temperature") << pc::T() << " K\n"
+              << pad(SUB, w, "Analytic energy scaling") << (scaling != nullptr ? "yes" : "no") << "\n";
             if ( base::cnt > 0 )
             {
                 char l = 14;
@@ -2817,6 +4612,48 @@
         template<class Tspace>
         double Isobaric<Tspace>::_energyChange()
         {
+            if ( scaling != nullptr )
+            {
+                Point r = newlen.cwiseQuotient(oldlen);
+                if ( std::fabs(r.x() - r.y()) < 1e-12 && std::fabs(r.x() - r.z()) < 1e-12 )
+                {
+                    double du = scaling->scalingEnergyChange(r.x());
+                    if ( !std::isnan(du))
+                    {
+                        auto backup = spc->geo; // remaining terms - external energies only
+                        spc->geo = spc->geo_trial;
+                        pot->setSpace(*spc);
+                        double duext = pot->external(spc->trial);
+                        for ( auto g : spc->groupList())
+                            duext += pot->g_external(spc->trial, *g);
+                        spc->geo = backup;
+                        pot->setSpace(*spc);
+                        duext -= pot->external(spc->p);
+                        for ( auto g : spc->groupList())
+                            duext -= pot->g_external(spc->p, *g);
+
+                        if ( scalecheck > 0 && (base::cnt - 1) % scalecheck == 0 )
+                        {
+                            double duFull = Energy::energyChange(*spc, *pot, change);
+                            auto mismatch = [&]( double u ) { return std::fabs(u - duFull) > 1e-6 * (1 + std::fabs(duFull)); };
+                            if ( mismatch(du + duext))
+                            {
+                                scaling->invalidate(); // accumulated round-off? try again from scratch
+                                du = scaling->scalingEnergyChange(r.x());
+                                if ( mismatch(du + duext))
+                                {
+                                    std::cerr << base::title << ": analytic energy change (" << du + duext
+                                              << " kT) differs from full evaluation (" << duFull
+                                              << " kT) - analytic scaling disabled." << endl;
+                                    scaling = nullptr;
+                                    return duFull;
+                                }
+                            }
+                        }
+                        return du + duext;
+                    }
+                }
+            }
             return Energy::energyChange(*spc, *pot, change);
         }
 
@@ -2909,6 +4746,309 @@
             }
         }
 
+        /**
+         * @brief Occupancy grid of cavities for cavity-biased insertion
+         *
+         * The `Cuboid` container is divided into cells and a cell is a *cavity*
+         * if no particle is closer than `probe` to its centre. Positions
+         * generated by `randompos()` are uniformly distributed within the cavity
+         * cells, i.e. with probability density \f$1/(V P_{cav})\f$ where
+         * \f$P_{cav}\f$ is the cavity volume fraction. Grand canonical moves
+         * must correct for this bias by replacing \f$V\f$ with
+         * \f$V P_{cav}\f$ in the acceptance, where for deletions \f$P_{cav}\f$
+         * refers to the system without the removed particles, see
+         * `fractionWithout()`.
+         *
+         * The number of particles covering each cell is stored and `sync()`
+         * updates the grid only for particles that moved since the last call.
+         * These are collected from the `Change` of accepted moves, see
+         * `Movebase::changeListeners()`, so that a sync costs O(moved particles).
+         * If an accepted move reports no change or bypasses `Movebase::acceptMove()`,
+         * all positions are compared instead. Changes made to `Space::p` outside
+         * of moves must be followed by a call to `rebuild()`.
+         * Insertions and deletions are registered with `insert()` and `erase()`;
+         * any other change in particle number or box size leads to a rebuild.
+         */
+        template<class Tspace>
+        class CavityGrid
+        {
+        private:
+            Tspace *spc;
+            Geometry::Cuboid *geo;
+            double probe;                 // probe radius
+            double cellsize;              // requested cell size
+            Point len, h;                 // box and cell side lengths
+            int n[3];                     // number of cells in each direction
+            std::vector<int> count;       // number of particles closer than probe to cell centre
+            std::vector<int> empty;       // index of cavity cells
+            std::vector<int> where;       // position of cell in `empty` (-1 if occupied)
+            std::vector<Point> pos;       // positions registered in grid
+            std::vector<int> moved;       // particles moved by accepted moves since last sync
+            unsigned long synced;         // `Movebase::acceptedMoves()` at last sync
+            unsigned long notified;       // accepted moves with known change since last sync
+            bool registered;              // insertion/deletion registered during current move
+
+            int index( int i, int j, int k ) const
+            {
+                i = (i % n[0] + n[0]) % n[0];
+                j = (j % n[1] + n[1]) % n[1];
+                k = (k % n[2] + n[2]) % n[2];
+                return i + n[0] * (j + n[1] * k);
+            }
+
+            Point center( int c ) const
+            {
+                int i = c % n[0], j = (c / n[0]) % n[1], k = c / (n[0] * n[1]);
+                return Point((i + 0.5) * h.x(), (j + 0.5) * h.y(), (k + 0.5) * h.z()) - 0.5 * len;
+            }
+
+            int cell( const Point &a ) const
+            {
+                return index(int(std::floor((a.x() + 0.5 * len.x()) / h.x())),
+                             int(std::floor((a.y() + 0.5 * len.y()) / h.y())),
+                             int(std::floor((a.z() + 0.5 * len.z()) / h.z())));
+            }
+
+            /** @brief Call `f` for each cell with centre closer than `probe` to `a` */
+            template<class Tfunc>
+            void forCells( const Point &a, Tfunc f ) const
+            {
+                int lo[3], hi[3];
+                for ( int d = 0; d < 3; d++ )
+                {
+                    lo[d] = int(std::floor((a[d] + 0.5 * len[d] - probe) / h[d]));
+                    hi[d] = int(std::floor((a[d] + 0.5 * len[d] + probe) / h[d]));
+                    if ( hi[d] - lo[d] >= n[d] )
+                        hi[d] = lo[d] + n[d] - 1; // visit each cell only once
+                }
+                double p2 = probe * probe;
+                for ( int k = lo[2]; k <= hi[2]; k++ )
+                    for ( int j = lo[1]; j <= hi[1]; j++ )
+                        for ( int i = lo[0]; i <= hi[0]; i++ )
+                        {
+                            int c = index(i, j, k);
+                            if ( geo->sqdist(a, center(c)) < p2 )
+                                f(c);
+                        }
+            }
+
+            void add( const Point &a, int sign )
+            {
+                forCells(a, [&]( int c )
+                {
+                    count[c] += sign;
+                    if ( count[c] == 0 )
+                    { // became cavity
+                        where[c] = empty.size();
+                        empty.push_back(c);
+                    }
+                    else if ( count[c] == sign && sign > 0 )
+                    { // became occupied
+                        empty[where[c]] = empty.back();
+                        where[empty.back()] = where[c];
+                        empty.pop_back();
+                        where[c] = -1;
+                    }
+                });
+            }
+
+            void reset()
+            {
+                moved.clear();
+                synced = Movebase<Tspace>::acceptedMoves();
+                notified = 0;
+                registered = false;
+            }
+
+            /** @brief Update particle `i` if it moved */
+            void update( int i )
+            {
+                if ( pos[i] != spc->p[i] )
+                {
+                    add(pos[i], -1);
+                    add(spc->p[i], 1);
+                    pos[i] = spc->p[i];
+                }
+            }
+
+            /** @brief Collect moved particles from the change of an accepted move */
+            void notify( const typename Tspace::Change &c )
+            {
+                bool known = !c.empty() || registered;
+                registered = false;
+                if ( synced + notified + 1 != Movebase<Tspace>::acceptedMoves())
+                    return; // already behind; `sync()` compares all positions
+                if ( !known || moved.size() > pos.size())
+                {
+                    moved.clear(); // unknown change or cheaper to compare all; `notified` falls behind
+                    return;
+                }
+                notified++;
+                for ( auto &m : c.mvGroup )
+                    if ( m.second.empty()) // whole group
+                    {
+                        if ( m.first < (int) spc->groupList().size())
+                        {
+                            auto g = spc->groupList()[m.first];
+                            moved.insert(moved.end(), g->begin(), g->end());
+                        }
+                    }
+                    else
+                        moved.insert(moved.end(), m.second.begin(), m.second.end());
+            }
+
+        public:
+            CavityGrid( Tspace &s, double probe, double cellsize ) : spc(&s), probe(probe), cellsize(cellsize),
+                                                                       registered(false)
+            {
+                geo = dynamic_cast<Geometry::Cuboid *>(&s.geo);
+                if ( geo == nullptr )
+                    throw std::runtime_error("Cavity bias requires a Cuboid geometry");
+                if ( probe <= 0 || cellsize <= 0 )
+                    throw std::runtime_error("Cavity probe radius and cell size must be positive");
+                rebuild();
+                Movebase<Tspace>::changeListeners()[this] = [this]( const typename Tspace::Change &c ) { notify(c); };
+            }
+
+            CavityGrid( const CavityGrid & ) = delete;
+            CavityGrid &operator=( const CavityGrid & ) = delete;
+
+            ~CavityGrid() { Movebase<Tspace>::changeListeners().erase(this); }
+
+            /** @brief Register all particles from scratch */
+            void rebuild()
+            {
+                len = geo->len;
+                for ( int d = 0; d < 3; d++ )
+                {
+                    n[d] = std::max(1, int(len[d] / cellsize));
+                    h[d] = len[d] / n[d];
+                }
+                int N = n[0] * n[1] * n[2];
+                count.assign(N, 0);
+                where.resize(N);
+                empty.resize(N);
+                std::iota(empty.begin(), empty.end(), 0);
+                std::iota(where.begin(), where.end(), 0);
+                pos.clear();
+                pos.reserve(spc->p.size());
+                for ( auto &i : spc->p )
+                {
+                    pos.push_back(i);
+                    add(i, 1);
+                }
+                reset();
+            }
+
+            /** @brief Update grid with particles that moved since last call */
+            void sync()
+            {
+                if ( pos.size() != spc->p.size() || len != geo->len )
+                    return rebuild();
+                if ( synced + notified == Movebase<Tspace>::acceptedMoves())
+                {
+                    for ( auto i : moved )
+                        if ( i >= 0 && i < (int) pos.size())
+                            update(i);
+                }
+                else
+                    for ( size_t i = 0; i < pos.size(); i++ )
+                        update(i);
+                reset();
+            }
+
+            /** @brief Register particle inserted at index `i` in `Space::p` */
+            void insert( int i, const Point &a )
+            {
+                pos.insert(pos.begin() + i, a);
+                add(a, 1);
+                for ( auto &m : moved )
+                    if ( m >= i )
+                        m++;
+                registered = true;
+            }
+
+            /** @brief Register particle to be erased from index `i` in `Space::p`; call before `Space::erase()` */
+            void erase( int i )
+            {
+                add(pos.at(i), -1);
+                int j = spc->eraseSource(i);
+                for ( auto &m : moved ) // follow particles to their new index
+                    if ( m == i )
+                        m = -1;         // erased
+                    else if ( m == j )
+                        m = i;
+                    else if ( m > j )
+                        m--;
+                if ( j != i )
+                {
+                    pos[i] = pos[j];
+                    i = j;
+                }
+                pos.erase(pos.begin() + i);
+                registered = true;
+            }
+
+            /** @brief Cavity volume fraction */
+            double fraction() const { return empty.size() / double(count.size()); }
+
+            /** @brief True if point is in a cavity */
+            bool isCavity( const Point &a ) const { return count[cell(a)] == 0; }
+
+            /**
+             * @brief Random position in cavity
+             * @return False if there are no cavities
+             */
+            bool randompos( Point &a ) const
+            {
+                if ( empty.empty())
+                    return false;
+                Point c = center(*slump.element(empty.begin(), empty.end()));
+                a = c + Point(slump.half() * h.x(), slump.half() * h.y(), slump.half() * h.z());
+                geo->boundary(a);
+                return true;
+            }
+
+            /**
+             * @brief Cavity fraction without the particles in `index`
+             * @return Negative number if any of the particles would not be in a cavity
+             */
+            double fractionWithout( const std::vector<int> &index ) const
+            {
+                std::vector<Point> points;
+                points.reserve(index.size());
+                for ( auto i : index )
+                    points.push_back(pos.at(i));
+                return fractionWithout(index, points);
+            }
+
+            /**
+             * @brief Cavity fraction without the particles in `index`
+             * @return Negative number if any of `points` would not be in a cavity
+             *
+             * Used for molecules where the mass centre, rather than each
+             * particle, is placed in a cavity.
+             */
+            double fractionWithout( const std::vector<int> &index, const std::vector<Point> &points ) const
+            {
+                std::map<int, int> removed; // cell -> number of removed particles covering it
+                for ( auto i : index )
+                    forCells(pos.at(i), [&]( int c ) { removed[c]++; });
+                int nempty = empty.size();
+                for ( auto &m : removed )
+                    if ( count[m.first] == m.second )
+                        nempty++;
+                for ( auto &a : points )
+                {
+                    int c = cell(a);
+                    auto it = removed.find(c);
+                    if ( count[c] != (it == removed.end() ? 0 : it->second))
+                        return -1;
+                }
+                return nempty / double(count.size());
+            }
+        };
+
         /**
          * @brief Grand Canonical insertion of arbitrary M:X salt pairs
          *
@@ -2924,6 +5064,13 @@
          * where `mysalt` must be an atomic molecule. Only atom types with
          * non-zero activities will be considered.
          *
+         * For dense systems in a `Cuboid`, insertions can be restricted to
+         * cavities using `CavityGrid` by specifying `cavityprobe` (probe radius
+         * measured from particle centres, angstrom) and optionally `cavitycell`
+         * (grid spacing, default: half the probe radius). The cavity bias is
+         * corrected for in the acceptance and the average cavity fraction
+         * is reported. Insertions are rejected if there are no cavities.
+         *
          * @date Lund 2010-2011
          * @warning Untested for asymmetric salt in this branch
          */
@@ -2971,6 +5118,10 @@
             Group *saltPtr;  // GC ions *must* be in this group
             int saltmolid;   // Molecular ID of salt
 
+            std::shared_ptr<CavityGrid<Tspace>> cavity; // cavity bias (optional)
+            double pcav;                                 // cavity fraction for current move
+            Average<double> cavfrac;                     // average cavity fraction
+
             // unit testing
             void _test( UnitTest &t ) override
             {
@@ -2996,6 +5147,7 @@
             base::useAlternativeReturnEnergy = true;
             base::runfraction = j.value("prob", 1.0);
             string saltname = j.at("molecule");
+            pcav = 1;
 
             auto v = spc->findMolecules(saltname);
             if ( v.empty())
@@ -3013,6 +5165,10 @@
                 saltPtr = v.front();
             }
             add(*saltPtr);
+
+            double probe = j.value("cavityprobe", 0.0);
+            if ( probe > 0 )
+                cavity = std::make_shared<CavityGrid<Tspace>>(*spc, probe, j.value("cavitycell", probe / 2));
         }
 
         template<class Tspace>
@@ -3048,6 +5204,7 @@
         {
             trial_insert.clear();
             trial_delete.clear();
+            pcav = 1;
 
             randomIonPair(ida, idb);
 
@@ -3072,8 +5229,22 @@
                     }
                     while ( --Nb > 0 );
 
-                    for ( auto &p : trial_insert ) //assign random positions
-                        spc->geo.randompos(p);
+                    if ( cavity )
+                    {
+                        cavity->sync();
+                        pcav = cavity->fraction();
+                        cavfrac += pcav;
+                        for ( auto &p : trial_insert ) // random positions in cavities
+                            if ( !cavity->randompos(p))
+                            {
+                                trial_insert.clear(); // abort - no cavities
+                                pcav = 0;             // ...and reject
+                                return;
+                            }
+                    }
+                    else
+                        for ( auto &p : trial_insert ) //assign random positions
+                            spc->geo.randompos(p);
                     break;
 
                 case 1: // attempt to delete
@@ -3109,6 +5280,11 @@
                         trial_delete.push_back(i);
                     }
                     assert( trial_delete.size() == Na + Nb);
+                    if ( cavity )
+                    {
+                        cavity->sync();
+                        pcav = cavity->fractionWithout(trial_delete); // negative if not in cavity
+                    }
                     break;
             }
         }
@@ -3121,6 +5297,10 @@
             double uold = 0, unew = 0, V = spc->geo.getVolume();
             double potold = 0, potnew = 0; // energy change due to interactions
 
+            base::alternateReturnEnergy = 0;
+            if ( cavity && pcav <= 0 )
+                return pc::infty; // no cavity for insertion or reverse insertion not possible
+
             if ( trial_insert.size() > 0 )
             {
                 for ( auto &t : trial_insert )     // count added ions
@@ -3134,6 +5314,8 @@
                     idfactor *= (spc->atomTrack[idb].size() + 1 + n) / V;
 
                 unew = log(idfactor) - Na * map[ida].chempot - Nb * map[idb].chempot;
+                if ( cavity )
+                    unew -= (Na + Nb) * log(pcav); // V -> V*pcav
 
                 potnew += pot->v2v(spc->p, trial_insert);
                 for ( auto i = trial_insert.begin(); i != trial_insert.end() - 1; i++ )
@@ -3160,6 +5342,8 @@
                     idfactor *= (spc->atomTrack[idb].size() - Nb + 1 + n) / V;
 
                 unew = -log(idfactor) + Na * map[ida].chempot + Nb * map[idb].chempot;
+                if ( cavity )
+                    unew += (Na + Nb) * log(pcav);
 
                 for ( auto &i : trial_delete )
                     potold += pot->i_total(spc->p, i);
@@ -3188,13 +5372,20 @@
                 saltPtr = spc->insert( saltmolid, trial_insert );
                 assert( saltPtr!=nullptr );
                 assert( saltPtr->size() == Nold + (int)trial_insert.size() );
+                if ( cavity )
+                    for ( size_t n = 0; n < trial_insert.size(); n++ )
+                        cavity->insert(saltPtr->back() - trial_insert.size() + 1 + n, trial_insert[n]);
             }
 
             if ( !trial_delete.empty()) {
                 assert(saltPtr!=nullptr);
                 std::sort(trial_delete.rbegin(), trial_delete.rend()); //reverse sort
                 for ( auto i : trial_delete )
+                {
+                    if ( cavity )
+                        cavity->erase(i);
                     spc->erase(i);
+                }
             }
 
             double V = spc->geo.getVolume();
@@ -3216,6 +5407,8 @@
             char s = 10;
             using namespace textio;
             std::ostringstream o;
+            if ( cavity && cavfrac.cnt > 0 )
+                o << pad(SUB, w, "Average cavity fraction") << cavfrac.avg() << endl;
             o << pad(SUB, w, "Number of GC species") << endl << endl;
             o << setw(4) << "" << std::left
               << setw(s) << "Ion" << setw(s) << "activity"
@@ -3241,6 +5434,8 @@
             if ( base::cnt > 0 )
             {
                 auto &j = js[base::title];
+                if ( cavity && cavfrac.cnt > 0 )
+                    j["cavity fraction"] = cavfrac.avg();
                 for ( auto &m : map )
                 { // loop over GC species
                     Tid id = m.first;
@@ -4235,6 +6430,25 @@
          * This is a general class for GCMC that can handle both
          * atomic and molecular species at constant chemical potential.
          *
+         * If `ktrial` (default: 0) is given in the `moves/gc` section, molecules
+         * connected by harmonic bonds are inserted and deleted using
+         * configurational-bias growth with `ktrial` trial positions per bead,
+         * see `RosenbluthGrowth`. The activity then refers to an ideal gas of
+         * chains with only bonded interactions. Molecules that cannot be grown,
+         * e.g. with FENE bonds, are inserted as rigid conformations and listed
+         * with the reason in the move information. Internal energy not seen during
+         * growth, i.e. the difference between `g_internal()` of the grown
+         * molecule and the intramolecular growth energy, enters the acceptance.
+         *
+         * In a `Cuboid`, the mass centres of rigid molecules can be inserted
+         * in cavities only by specifying `cavityprobe` and optionally
+         * `cavitycell`, see `CavityGrid` and `GrandCanonicalSalt`. Volumes in
+         * the acceptance of these molecules are then scaled by the cavity
+         * fraction and deletions are rejected if the mass centre would not be
+         * in a cavity. Atomic and grown molecules are always inserted in the
+         * full volume. As insertions and deletions change the particle
+         * ordering, the grid is rebuilt after each accepted move.
+         *
          * @todo Currently tested only with rigid, molecular species. Move
          *       external energy calculation into Hamiltonian. Move particle
          *       density analysis to Faunus::Analysis.
@@ -4260,6 +6474,18 @@
             unsigned int Ndeleted, Ninserted;    // Number of accepted deletions and insertions
             bool insertBool;                     // current status - either insert or delete
             typename MoleculeCombinationMap<Tpvec>::iterator it; // current combination
+            RosenbluthGrowth<Tspace> cbmc;       // growth of flexible molecules
+            int ktrial;                          // trial positions per bead; 0 = no growth
+            double lnW, ucbmc, ucbmcintra;       // Rosenbluth factor and energies seen by growth
+            std::shared_ptr<CavityGrid<Tspace>> cavity; // cavity bias (optional)
+            double pcav;                         // cavity fraction for current move
+            Average<double> cavfrac;             // average cavity fraction
+
+            /** @brief True if molecule should be inserted/deleted by configurational-bias growth */
+            bool grown( int molid ) { return ktrial > 0 && cbmc.growable(molid); }
+
+            /** @brief True if molecule mass centre is inserted in a cavity */
+            bool cavitybiased( int molid ) { return cavity && !spc->molecule[molid].isAtomic() && !grown(molid); }
 
             /** @brief Perform an insertion or deletion trial move */
             void _trialMove() override
@@ -4269,6 +6495,8 @@
                 base::alternateReturnEnergy = 0;
                 molcnt.clear();
                 atomcnt.clear();
+                lnW = ucbmc = ucbmcintra = 0;
+                pcav = 1;
                 it = comb.random();                 // random combination
                 for ( auto id : it->molComb )
                 {     // loop over molecules in combination
@@ -4303,16 +6531,70 @@
                         pmap.clear();
                     }
                     else
+                    {
                         assert(!molDel.empty() || !atomDel.empty());
+                        std::vector<int> exclude;  // Rosenbluth factor of deleted molecules without these
+                        for ( auto g : molDel )
+                            exclude.insert(exclude.end(), g->begin(), g->end());
+                        for ( auto g : molDel )
+                            if ( grown(g->molId))
+                            {
+                                Tpvec v(spc->p.begin() + g->front(), spc->p.begin() + g->back() + 1);
+                                lnW += cbmc.grow(v, g->molId, exclude, 0, slump.range(0, 1), ktrial, true);
+                                ucbmc += cbmc.uinter;
+                                ucbmcintra += cbmc.uintra;
+                            }
+                        if ( cavity )
+                        {
+                            std::vector<Point> cm;  // mass centres that must be in cavities
+                            for ( auto g : molDel )
+                                if ( cavitybiased(g->molId))
+                                    cm.push_back(Geometry::massCenter(spc->geo, spc->p, *g));
+                            if ( !cm.empty())
+                            {
+                                exclude.insert(exclude.end(), atomDel.begin(), atomDel.end());
+                                cavity->sync();
+                                pcav = cavity->fractionWithout(exclude, cm); // negative if not in cavity
+                            }
+                        }
+                    }
                 }
 
                 // try insert move (nothing is actually inserted - just a proposed configuration)
                 if ( insertBool )
                 {
                     pmap.clear();
+                    for ( auto molid : it->molComb )
+                        if ( cavitybiased(molid))
+                        {
+                            cavity->sync();
+                            pcav = cavity->fraction();
+                            cavfrac += pcav;
+                            break;
+                        }
                     for ( auto molid : it->molComb ) // loop over molecules in combination
-                        pmap.insert(
-                            {molid, spc->molecule[molid].getRandomConformation(base::spc->geo, base::spc->p)});
+                        if ( grown(molid))
+                        {
+                            Tpvec v = spc->molecule[molid].getRandomConformation();
+                            lnW += cbmc.grow(v, molid, {}, 0, slump.range(0, 1), ktrial, false);
+                            ucbmc += cbmc.uinter;
+                            ucbmcintra += cbmc.uintra;
+                            pmap.insert({molid, v});
+                        }
+                        else
+                        {
+                            Tpvec v = spc->molecule[molid].getRandomConformation(spc->geo, spc->p);
+                            if ( cavitybiased(molid))
+                            {
+                                Point a;
+                                if ( cavity->randompos(a))  // move mass centre to random cavity
+                                    Geometry::translate(spc->geo, v,
+                                                        spc->geo.vdist(a, Geometry::massCenter(spc->geo, v)));
+                                else
+                                    pcav = 0;               // no cavities -> reject
+                            }
+                            pmap.insert({molid, v});
+                        }
                     assert(!pmap.empty());
                 }
             }
@@ -4328,8 +6610,11 @@
 
                 for ( auto i : molcnt )                  // loop over molecule types
                     if ( !spc->molecule[i.first].isAtomic())
+                    {
+                        double Vi = cavitybiased(i.first) ? V * pcav : V; // V -> V*pcav
                         for ( int n = 0; n < i.second; n++ )       // loop over n number of molecules
-                            u += log((spc->molTrack.size(i.first) + bit) / V) - spc->molecule[i.first].chemPot;
+                            u += log((spc->molTrack.size(i.first) + bit) / Vi) - spc->molecule[i.first].chemPot;
+                    }
 
                 for ( auto i : atomcnt )                 // loop over atom types
                     for ( int n = 0; n < i.second; n++ )         // loop over n number of atoms
@@ -4343,10 +6628,17 @@
 
                 double u = 0;         // change in potential energy (kT)
                 double uinternal = 0; // change in internal, molecular energy (kT)
+                double ugrown = 0;    // internal energy of grown molecules (kT)
+
+                base::alternateReturnEnergy = 0;
+                if ( pcav <= 0 )
+                    return pc::infty; // no cavity for insertion or reverse insertion not possible
 
                 // energy if insertion move
                 if ( insertBool )
                 {
+                    if ( lnW == -pc::infty )
+                        return pc::infty; // growth failed
                     for ( auto &p : pmap )
                     {                         // loop over molecules
                         Group g(0, p.second.size() - 1);               // (first=id, second=pvec)
@@ -4365,7 +6657,10 @@
                         {
                             for ( auto g2 : spc->groupList())           // ...molecules with all groups
                                 u += pot->g1g2(p.second, g, spc->p, *g2);
-                            uinternal += pot->g_internal(p.second, g); // ...internal mol energy (dummy)
+                            if ( grown(g.molId))
+                                ugrown += pot->g_internal(p.second, g);    // ...internal energy of grown mol
+                            else
+                                uinternal += pot->g_internal(p.second, g); // ...internal mol energy (dummy)
                         }
                     }
 
@@ -4380,8 +6675,9 @@
                         }
 
                     assert(!pmap.empty());
-                    base::alternateReturnEnergy = u + uinternal;
-                    return u + externalEnergy();
+                    // growth weights include `ucbmcintra`; correct for the full internal energy
+                    base::alternateReturnEnergy = u + uinternal + ugrown;
+                    return u + externalEnergy() - lnW - ucbmc + (ugrown - ucbmcintra);
                 }
 
                     // energy if deletion move
@@ -4389,6 +6685,8 @@
                 {
                     if ( !molDel.empty() || !atomDel.empty())
                     {
+                        if ( lnW == pc::infty )
+                            return pc::infty; // deleted molecule could not have been grown
                         for ( auto i : molDel )
                         {                     // loop over molecules/atoms
                             u += pot->g_external(spc->p, *i);         // molecule w. external pot.
@@ -4398,7 +6696,10 @@
                                 for ( auto j : spc->groupList())         // molecule w. all groups
                                     if ( find(molDel.begin(), molDel.end(), j) == molDel.end()) // slow!
                                         u += pot->g2g(spc->p, *i, *j);
-                                uinternal += pot->g_internal(spc->p, *i);// internal mol energy (dummy)
+                                if ( grown(i->molId))
+                                    ugrown += pot->g_internal(spc->p, *i);   // internal energy of grown mol
+                                else
+                                    uinternal += pot->g_internal(spc->p, *i);// internal mol energy (dummy)
                             }
                         }
 
@@ -4414,8 +6715,8 @@
                             for ( int j = i + 1; j < (int) atomDel.size(); j++ ) // internal energy (atoms)
                                 u -= pot->i2i(spc->p, i, j);
 
-                        base::alternateReturnEnergy = -u - uinternal;
-                        return -u + externalEnergy(); // ...add activity terms
+                        base::alternateReturnEnergy = -u - uinternal - ugrown;
+                        return -u + externalEnergy() + lnW + ucbmc - (ugrown - ucbmcintra); // ...add activity terms
                     }
                 }
 
@@ -4482,8 +6783,18 @@
 
                 o << pad(SUB, base::w, "Accepted insertions") << Ninserted << "\n"
                   << pad(SUB, base::w, "Accepted deletions") << Ndeleted << "\n"
-                  << pad(SUB, base::w, "Flux (Nins/Ndel)") << Ninserted / double(Ndeleted) << "\n"
-                  << "\n";
+                  << pad(SUB, base::w, "Flux (Nins/Ndel)") << Ninserted / double(Ndeleted) << "\n";
+                if ( cavity && cavfrac.cnt > 0 )
+                    o << pad(SUB, base::w, "Average cavity fraction") << cavfrac.avg() << "\n";
+                if ( ktrial > 0 )
+                {
+                    o << pad(SUB, base::w, "Growth trials per bead") << ktrial << "\n";
+                    for ( auto &m : spc->molecule )
+                        if ( m.isMolecular() && m.activity > 1e-10 )
+                            o << pad(SUB, base::w, "Growth of " + m.name)
+                              << (grown(m.id) ? string("yes") : "no (" + cbmc.reason(m.id) + ")") << "\n";
+                }
+                o << "\n";
 
                 double V = spc->geo.getVolume();
                 o << std::left
@@ -4547,11 +6858,16 @@
 
             /** @brief Constructor -- load combinations, initialize trackers */
             GreenGC(
-                Energy::Energybase<Tspace> &e, Tspace &s, Tmjson &j ) : base(e, s), comb(s.molecule)
+                Energy::Energybase<Tspace> &e, Tspace &s, Tmjson &j ) : base(e, s), comb(s.molecule), cbmc(s, e)
             {
                 init();
                 base::runfraction = j.value("prob", 1.0);
+                ktrial = j.value("ktrial", 0);
                 comb.include(j); // load combinations
+                pcav = 1;
+                double probe = j.value("cavityprobe", 0.0);
+                if ( probe > 0 )
+                    cavity = std::make_shared<CavityGrid<Tspace>>(*spc, probe, j.value("cavitycell", probe / 2));
             }
         };
 
@@ -4570,6 +6886,25 @@
          * `prob`          |  probability of running (default: 1)
          * `savecharge`    |  save average charge upon destruction (default: false)
          * `processes`     |  List of equilibrium processes, see `Energy::EquilibriumController`
+         * `sitecache`     |  cache pair energy change of each site and state (default: false)
+         * `sitecheck`     |  compare cached energy with full evaluation every n'th move (default: 1000)
+         *
+         * Titratable sites are located once and re-scanned only if the number
+         * or type of titratable particles changed by other moves.
+         *
+         * With `sitecache`, the energy change of every site in each of its
+         * alternative states, i.e. \f$\Delta q_i\phi_i\f$ plus short-ranged,
+         * external and intrinsic terms, is stored so that a swap attempt costs
+         * O(1) instead of two loops over all particles. Accepted swaps and
+         * particles moved by other moves update the cache in O(number of sites).
+         * This requires the pair energy to be the sum of `Energybase::p2p()` over
+         * all other particles and the particle external and intrinsic energies to
+         * depend only on the state and position of the site itself. The system
+         * term `Energybase::external()` is not cached but evaluated for each swap.
+         * All sites are compared with a full evaluation upon construction and an
+         * exception is thrown if the Hamiltonian violates these requirements.
+         * Every `sitecheck`'th cached move is checked again and the cache is
+         * disabled if it disagrees.
          */
         template<class Tspace>
         class SwapMove : public Movebase<Tspace>
@@ -4592,12 +6927,242 @@
                 molCharge[g->molId][pindex - g->front()] += spc->p[pindex].charge;
             }
 
+            typedef typename Tspace::ParticleType Tparticle;
+            typedef std::vector<std::pair<int, double>> Tsitecache; // atom id of alternative state -> energy change
+
+            int sitecheck;                               // full energy check every n'th cached move
+            unsigned long int cachecnt;                  // number of energy evaluations from cache
+            std::map<int, Tsitecache> sitecache;         // site -> energy changes
+            typename Tspace::ParticleVector snapshot;    // particles as seen by the cache
+
+            /** @brief Re-scan titratable sites if their number or types changed */
+            void syncSites()
+            {
+                auto &p = spc->p;
+                std::set<int> ids;
+                for ( auto &prs : eqpot->eq.process )
+                {
+                    ids.insert(prs.id_AX);
+                    ids.insert(prs.id_A);
+                }
+                size_t n = 0;
+                for ( auto id : ids )
+                    n += spc->atomTrack.size(id);
+                bool valid = (n == eqpot->eq.sites.size());
+                if ( valid )
+                    for ( auto i : eqpot->eq.sites )
+                        if ( i >= (int) p.size() || ids.count(p[i].id) == 0 )
+                        {
+                            valid = false;
+                            break;
+                        }
+                if ( !valid )
+                {
+                    eqpot->findSites(p);
+                    snapshot.clear();
+                }
+            }
+
+            /** @brief Site `i` in all states reachable by a single swap */
+            std::vector<Tparticle> alternatives( int i )
+            {
+                std::vector<Tparticle> v;
+                for ( auto &prs : eqpot->eq.process )
+                    if ( prs.one_of_us(spc->p[i].id))
+                    {
+                        Tparticle a = spc->p[i];
+                        prs.swap(a);
+                        v.push_back(a);
+                    }
+                return v;
+            }
+
+            /** @brief Pair energy change of site `i` in state `a` with particle `b` */
+            double pairChange( int i, const Tparticle &a, const Tparticle &b )
+            {
+                return pot->p2p(a, b) - pot->p2p(spc->p[i], b);
+            }
+
+            /** @brief Pair energy changes of site `i` evaluated from scratch */
+            Tsitecache evaluatePairs( int i )
+            {
+                Tsitecache c;
+                for ( auto &a : alternatives(i))
+                {
+                    double du = 0;
+                    for ( int j = 0; j < (int) spc->p.size(); j++ )
+                        if ( j != i )
+                            du += pairChange(i, a, spc->p[j]);
+                    c.push_back({a.id, du});
+                }
+                return c;
+            }
+
+            /** @brief External and intrinsic energy change of site `i` in state `a`; uses `spc->trial` */
+            double externalChange( int i, const Tparticle &a )
+            {
+                auto &t = spc->trial;
+                t[i] = a;
+                double du = pot->i_external(t, i) - pot->i_external(spc->p, i)
+                    + pot->i_internal(t, i) - pot->i_internal(spc->p, i);
+                t[i] = spc->p[i];
+                return du;
+            }
+
+            /** @brief Cached part of the energy change of site `i`, evaluated from scratch for `spc->trial` */
+            double siteChange( int i )
+            {
+                return pot->i_total(spc->trial, i) - pot->i_total(spc->p, i);
+            }
+
+            static bool differs( double u, double ref )
+            {
+                return std::fabs(u - ref) > 1e-6 * std::max(1.0, std::fabs(ref));
+            }
+
+            /**
+             * @brief Compare cached energy changes of all sites with a full evaluation
+             * @throws std::runtime_error if they differ, i.e. if energies are not pairwise additive
+             */
+            void checkCache()
+            {
+                syncCache();
+                for ( auto i : eqpot->eq.sites )
+                {
+                    auto alt = alternatives(i);
+                    auto &c = sitecache[i];
+                    for ( size_t k = 0; k < alt.size(); k++ )
+                    {
+                        spc->trial[i] = alt[k];
+                        double full = siteChange(i);
+                        spc->trial[i] = spc->p[i];
+                        if ( differs(c[k].second, full))
+                            throw std::runtime_error(base::title + ": `sitecache` requires pairwise additive"
+                                " energies and site-local external energies");
+                    }
+                }
+            }
+
+            /** @brief Add external and intrinsic energy changes to pair energy changes of site `i` */
+            void addExternal( int i, Tsitecache &c )
+            {
+                auto alt = alternatives(i);
+                for ( size_t k = 0; k < alt.size(); k++ )
+                    c[k].second += externalChange(i, alt[k]);
+            }
+
+            /** @brief Energy changes of site `i` evaluated from scratch */
+            Tsitecache evaluateSite( int i )
+            {
+                Tsitecache c = evaluatePairs(i);
+                addExternal(i, c);
+                return c;
+            }
+
+            /**
+             * @brief Energy changes of site `i` after an accepted swap from state `old`
+             *
+             * Obtained from the cache of the old state, \f$\Delta U_{new\rightarrow b}
+             * = \Delta U_{old\rightarrow b} - \Delta U_{old\rightarrow new}\f$, and
+             * only evaluated from scratch if a new state is not in the old cache.
+             */
+            Tsitecache swapSite( int i, const Tparticle &old )
+            {
+                auto &c = sitecache[i];
+                auto change = [&]( int id, double &du )
+                {
+                    du = 0;
+                    if ( id == old.id )
+                        return true;
+                    for ( auto &k : c )
+                        if ( k.first == id )
+                        {
+                            du = k.second;
+                            return true;
+                        }
+                    return false;
+                };
+                double dnew;
+                if ( !change(spc->p[i].id, dnew))
+                    return evaluateSite(i);
+                Tsitecache n;
+                for ( auto &a : alternatives(i))
+                {
+                    double du;
+                    if ( !change(a.id, du))
+                        return evaluateSite(i);
+                    n.push_back({a.id, du - dnew});
+                }
+                return n;
+            }
+
+            /**
+             * @brief Update site caches for particle `j` that changed from `old` to `spc->p[j]`
+             *
+             * Sites in `skip` are left untouched and must be re-evaluated.
+             */
+            void updateSites( int j, const Tparticle &old, const std::set<int> &skip = std::set<int>())
+            {
+                for ( auto i : eqpot->eq.sites )
+                    if ( i != j && skip.count(i) == 0 )
+                    {
+                        auto alt = alternatives(i);
+                        auto &c = sitecache[i];
+                        for ( size_t k = 0; k < alt.size(); k++ )
+                            c[k].second += pairChange(i, alt[k], spc->p[j]) - pairChange(i, alt[k], old);
+                    }
+            }
+
+            /**
+             * @brief Bring site cache in sync with particle vector
+             *
+             * Particles changed since last call are found by comparison with a
+             * snapshot. If more particles than sites changed, all sites are
+             * re-evaluated which then costs the same as a single sweep without
+             * cache.
+             */
+            void syncCache()
+            {
+                auto &p = spc->p;
+                auto &sites = eqpot->eq.sites;
+                std::vector<int> changed;
+                if ( snapshot.size() == p.size())
+                    for ( size_t j = 0; j < p.size(); j++ )
+                        if ( p[j].id != snapshot[j].id || p[j].charge != snapshot[j].charge
+                            || Point(p[j]) != Point(snapshot[j]))
+                            changed.push_back(j);
+                if ( snapshot.size() != p.size() || changed.size() > sites.size())
+                {
+                    std::vector<Tsitecache> c(sites.size());
+#pragma omp parallel for schedule (dynamic)
+                    for ( size_t k = 0; k < sites.size(); k++ )
+                        c[k] = evaluatePairs(sites[k]);
+                    sitecache.clear();
+                    for ( size_t k = 0; k < sites.size(); k++ )
+                    { // serial as `externalChange()` modifies the trial vector
+                        addExternal(sites[k], c[k]);
+                        sitecache[sites[k]] = c[k];
+                    }
+                }
+                else if ( !changed.empty())
+                {
+                    std::set<int> skip(changed.begin(), changed.end());
+                    for ( auto j : changed )
+                        updateSites(j, snapshot[j], skip);
+                    for ( auto i : changed )
+                        if ( sitecache.count(i) > 0 ) // changed particle is a site
+                            sitecache[i] = evaluateSite(i);
+                }
+                snapshot = p;
+            }
+
         protected:
             using base::spc;
             using base::pot;
 
             double _energyChange() override;
             int ipart;                              //!< Particle to be swapped
+            bool usecache;                          //!< Use cached pair energy changes for sites
             Energy::EquilibriumEnergy<Tspace> *eqpot;
 
         public:
@@ -4624,7 +7189,9 @@
                 double du = 0;
                 if ( this->run())
                 {
-                    eqpot->findSites(this->spc->p);
+                    syncSites();
+                    if ( usecache )
+                        syncCache();
                     size_t i = eqpot->eq.sites.size();
                     while ( i-- > 0 )
                         du += base::move();
@@ -4654,6 +7221,9 @@
             ipart = -1;
 
             saveChargeBool = j.value("savecharge", false);
+            usecache = j.value("sitecache", false);
+            sitecheck = j.value("sitecheck", 1000);
+            cachecnt = 0;
 
             auto t = e.tuple();
             auto ptr = TupleFindType::get<Energy::EquilibriumEnergy<Tspace> *>(t);
@@ -4670,6 +7240,9 @@
             /* Sync particle charges with `AtomMap` */
             for ( auto i : eqpot->eq.sites )
                 spc.trial[i].charge = spc.p[i].charge = atom[spc.p[i].id].charge;
+
+            if ( usecache && base::runfraction > 1e-4 )
+                checkCache();
         }
 
         /**
@@ -4683,6 +7256,7 @@
         int SwapMove<Tspace>::findSites( const Tpvec &p )
         {
             accmap.clear();
+            snapshot.clear();
             return eqpot->findSites(p);
         }
 
@@ -4712,6 +7286,27 @@
 
             if ( spc->geo.collision(spc->trial[ipart], spc->trial[ipart].radius))  // trial<->container collision?
                 return pc::infty;
+
+            if ( usecache )
+                for ( auto &c : sitecache[ipart] )
+                    if ( c.first == spc->trial[ipart].id )
+                    {
+                        double du = c.second;
+                        if ( sitecheck > 0 && ++cachecnt % sitecheck == 0 )
+                        {
+                            double full = siteChange(ipart);
+                            if ( differs(du, full))
+                            {
+                                std::cerr << base::title << ": cached energy change (" << du
+                                          << " kT) differs from full evaluation (" << full
+                                          << " kT) - site cache disabled." << endl;
+                                usecache = false;
+                                du = full;
+                            }
+                        }
+                        return du + pot->external(spc->trial) - pot->external(spc->p);
+                    }
+
             double uold = pot->external(spc->p) + pot->i_total(spc->p, ipart);
             double unew = pot->external(spc->trial) + pot->i_total(spc->trial, ipart);
 #ifdef ENABLE_MPI
@@ -4736,11 +7331,18 @@
         void SwapMove<Tspace>::_acceptMove()
         {
             accmap[ipart] += 1;
+            auto old = spc->p[ipart];
             spc->p[ipart] = spc->trial[ipart];
             updateMolCharge(ipart);
             // atom type changed -- update atom tracker
             spc->atomTrack.erase(ipart);
             spc->atomTrack.insert(spc->p[ipart].id, ipart);
+            if ( usecache )
+            {
+                updateSites(ipart, old);
+                sitecache[ipart] = swapSite(ipart, old);
+                snapshot[ipart] = spc->p[ipart];
+            }
         }
 
         template<class Tspace>
@@ -4846,6 +7448,7 @@
             {
                 this->title += " (min. shortrange)";
                 this->useAlternativeReturnEnergy = true;
+                this->usecache = false; // energy is evaluated with modified particles
             }
         };
         
@@ -4863,14 +7466,18 @@
          * `atomtranslate`   | `Move::AtomicTranslation`  | Translate atoms
          * `atomrotate`      | `Move::AtomicRotation`     | Rotate atoms
          * `atomgc`          | `Move::GrandCanonicalSalt` | GC salt move (muVT ensemble)
+         * `atomsmart`       | `Move::ForceBiasedTranslation` | Force-biased translation of atoms
          * `atomtranslate2D` | `Move::AtomicTranslation2D`| Translate atoms on a 2D hypersphere
+         * `checkerboard`    | `Move::CheckerboardSweep`  | Domain-parallel sweep (short-ranged)
          * `conformationswap`| `Move::ConformationSwap`   | Swap between molecular conformations
          * `crankshaft`      | `Move::CrankShaft`         | Crank shaft polymer move
          * `ctransnr`        | `Move::ClusterTranslateNR` | Rejection free cluster translate
          * `gc`              | `Move::GreenGC`            | Grand canonical move (muVT ensemble)
          * `isobaric`        | `Move::Isobaric`           | Volume move (NPT ensemple)
          * `moltransrot`     | `Move::TranslateRotate`    | Translate/rotate molecules
+         * `moltransrotsmart`| `Move::ForceBiasedTranslateRotate` | Force-biased translate/rotate molecules
          * `pivot`           | `Move::Pivot`              | Pivot polymer move
+         * `regrow`          | `Move::Regrowth`           | Configurational-bias polymer regrowth
          * `reptate`         | `Move::Reptation`          | Reptation polymer move
          * `temper`          | `Move::ParallelTempering`  | Parallel tempering (requires MPI)
          * `titrate`         | `Move::SwapMove`           | Particle swap move
@@ -4949,8 +7556,23 @@
             template<typename Tmove>
             basePtr toPtr( Tmove m )
             {
-                typedef typename std::conditional<polarise, PolarizeMove<Tmove>, Tmove>::type T;
-                return basePtr(new T(m)); // convert to std::make_unique<>() in C++14
+                return basePtr(new Tmove(m)); // convert to std::make_unique<>() in C++14
+            }
+
+            template<typename Tmove>
+            basePtr toPtr( Tmove m, Tmjson &, std::false_type ) { return toPtr(m); }
+
+            template<typename Tmove>
+            basePtr toPtr( Tmove m, Tmjson &j, std::true_type )
+            {
+                return basePtr(new PolarizeMove<Tmove>(m, j));
+            }
+
+            /** @brief As above, but wrapped in `PolarizeMove` if `polarise` is true */
+            template<typename Tmove>
+            basePtr toPtr( Tmove m, Tmjson &j )
+            {
+                return toPtr(m, j, std::integral_constant<bool, polarise>());
             }
 
         public:
@@ -4985,27 +7607,31 @@
                             }
 
                         if ( i.key() == "atomtranslate" )
-                            mPtr.push_back(toPtr(AtomicTranslation<Tspace>(e, s, val)));
+                            mPtr.push_back(toPtr(AtomicTranslation<Tspace>(e, s, val), val));
+                        if ( i.key() == "atomsmart" )
+                            mPtr.push_back(toPtr(ForceBiasedTranslation<Tspace>(e, s, val), val));
                         if ( i.key() == "atomrotate" )
-                            mPtr.push_back(toPtr(AtomicRotation<Tspace>(e, s, val)));
+                            mPtr.push_back(toPtr(AtomicRotation<Tspace>(e, s, val), val));
                         if ( i.key() == "atomgc" )
                             mPtr.push_back(toPtr(GrandCanonicalSalt<Tspace>(e, s, val)));
                         if (i.key()=="atomictranslation2D")
-                                        mPtr.push_back( toPtr( AtomicTranslation2D<Tspace>(e,s, val)));
+                                        mPtr.push_back( toPtr( AtomicTranslation2D<Tspace>(e,s, val), val));
                         if ( i.key() == "gctit" )
                             mPtr.push_back(toPtr(GrandCanonicalTitration<Tspace>(e, s, val)));
                         if ( i.key() == "moltransrot" )
-                            mPtr.push_back(toPtr(TranslateRotate<Tspace>(e, s, val)));
+                            mPtr.push_back(toPtr(TranslateRotate<Tspace>(e, s, val), val));
+                        if ( i.key() == "moltransrotsmart" )
+                            mPtr.push_back(toPtr(ForceBiasedTranslateRotate<Tspace>(e, s, val), val));
                         if ( i.key() == "conformationswap" )
                             mPtr.push_back(toPtr(ConformationSwap<Tspace>(e, s, val)));
                         if ( i.key() == "moltransrot2body" )
-                            mPtr.push_back(toPtr(TranslateRotateTwobody<Tspace>(e, s, val)));
+                            mPtr.push_back(toPtr(TranslateRotateTwobody<Tspace>(e, s, val), val));
                         if ( i.key() == "moltransrotcluster" )
-                            mPtr.push_back(toPtr(TranslateRotateCluster<Tspace>(e, s, val)));
+                            mPtr.push_back(toPtr(TranslateRotateCluster<Tspace>(e, s, val), val));
                         if ( i.key() == "isobaric" )
-                            mPtr.push_back(toPtr(Isobaric<Tspace>(e, s, val)));
+                            mPtr.push_back(toPtr(Isobaric<Tspace>(e, s, val), val));
                         if ( i.key() == "isochoric" )
-                            mPtr.push_back(toPtr(Isochoric<Tspace>(e, s, val)));
+                            mPtr.push_back(toPtr(Isochoric<Tspace>(e, s, val), val));
                         if ( i.key() == "gc" )
                             mPtr.push_back(toPtr(GreenGC<Tspace>(e, s, val)));
                         if ( i.key() == "titrate" )
@@ -5016,8 +7642,12 @@
                             mPtr.push_back(toPtr(Pivot<Tspace>(e, s, val)));
                         if ( i.key() == "reptate" )
                             mPtr.push_back(toPtr(Reptation<Tspace>(e, s, val)));
+                        if ( i.key() == "regrow" )
+                            mPtr.push_back(toPtr(Regrowth<Tspace>(e, s, val)));
                         if ( i.key() == "ctransnr" )
                             mPtr.push_back(toPtr(ClusterTranslateNR<Tspace>(e, s, val)));
+                        if ( i.key() == "checkerboard" )
+                            mPtr.push_back(toPtr(CheckerboardSweep<Tspace>(e, s, val)));
                         if ( i.key() == "xtcmove" )
                             mPtr.push_back(toPtr(TrajectoryMove<Tspace>(e, s, val)));
 #ifdef ENABLE_MPI
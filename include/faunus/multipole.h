@@ -412,8 +412,7 @@ namespace Faunus {
          */
         class CoulombGalore : public PairPotentialBase {
             private:
-                Tabulate::Andrea<double> sf; // splitting function
-                Tabulate::TabulatorBase<double>::data table; // data for splitting function
+                Tabulate::Kernel<Tabulate::Tkernel> sf; // splitting function
                 std::function<double(double)> calcDielectric; // function for dielectric const. calc.
                 string type;
 		double selfenergy_prefactor;
@@ -423,13 +422,13 @@ namespace Faunus {
                 void sfYukawa(const Tmjson &j) {
                     kappa = 1.0 / j.at("debyelength").get<double>();
                     I = kappa*kappa / ( 8.0*lB*pc::pi*pc::Nav/1e27 );
-                    table = sf.generate( [&](double q) { return std::exp(-q*rc*kappa) - std::exp(-kappa*rc); } ); // q=r/Rc 
+                    sf.generate( {{ [&](double q) { return std::exp(-q*rc*kappa) - std::exp(-kappa*rc); } }} ); // q=r/Rc 
                     // we could also fill in some info string or JSON output...
                 }
 
                 void sfReactionField(const Tmjson &j) {
                     epsrf = j.at("eps_rf");
-                    table = sf.generate( [&](double q) { return 1 + (( epsrf - epsr ) / ( 2 * epsrf + epsr ))*q*q*q - 3 * ( epsrf / ( 2 * epsrf + epsr ))*q ; } ); 
+                    sf.generate( {{ [&](double q) { return 1 + (( epsrf - epsr ) / ( 2 * epsrf + epsr ))*q*q*q - 3 * ( epsrf / ( 2 * epsrf + epsr ))*q ; } }} ); 
                     calcDielectric = [&](double M2V) {
                         if(epsrf > 1e10)
                             return 1 + 3*M2V;
@@ -447,7 +446,7 @@ namespace Faunus {
                 void sfQpotential(const Tmjson &j)
                 {
                     order = j.value("order",300);
-                    table = sf.generate( [&](double q) { return qPochhammerSymbol( q, 1, order ); } );
+                    sf.generate( {{ [&](double q) { return qPochhammerSymbol( q, 1, order ); } }} );
                     calcDielectric = [&](double M2V) { return 1 + 3*M2V; };
 		    selfenergy_prefactor = 0.5;
                 }
@@ -455,20 +454,20 @@ namespace Faunus {
                 void sfYonezawa(const Tmjson &j)
                 {
                     alpha = j.at("alpha");
-                    table = sf.generate( [&](double q) { return 1 - erfc(alpha*rc)*q + q*q; } );
+                    sf.generate( {{ [&](double q) { return 1 - erfc(alpha*rc)*q + q*q; } }} );
 		    calcDielectric = [&](double M2V) { return 1 + 3*M2V; };
 		    selfenergy_prefactor = erf(alpha*rc);
                 }
 
                 void sfFanourgakis(const Tmjson &j) {
-                    table = sf.generate( [&](double q) { return 1 - 1.75*q + 5.25*pow(q,5) - 7*pow(q,6) + 2.5*pow(q,7); } );
+                    sf.generate( {{ [&](double q) { return 1 - 1.75*q + 5.25*pow(q,5) - 7*pow(q,6) + 2.5*pow(q,7); } }} );
                     calcDielectric = [&](double M2V) { return 1 + 3*M2V; };
 		    selfenergy_prefactor = 0.875;
                 }
 
                 void sfFennel(const Tmjson &j) {
                     alpha = j.at("alpha");
-                    table = sf.generate( [&](double q) { return (erfc(alpha*rc*q) - erfc(alpha*rc)*q + (q-1.0)*q*(erfc(alpha*rc) + 2 * alpha * rc / sqrt(pc::pi) * exp(-alpha*alpha*rc*rc))); } );
+                    sf.generate( {{ [&](double q) { return (erfc(alpha*rc*q) - erfc(alpha*rc)*q + (q-1.0)*q*(erfc(alpha*rc) + 2 * alpha * rc / sqrt(pc::pi) * exp(-alpha*alpha*rc*rc))); } }} );
 		    calcDielectric = [&](double M2V) { double T = erf(alpha*rc) - (2 / (3 * sqrt(pc::pi))) * exp(-alpha*alpha*rc*rc) * (alpha*alpha*rc*rc * alpha*alpha*rc*rc + 2.0 * alpha*alpha*rc*rc + 3.0);
 						       return (((T + 2.0) * M2V + 1.0)/ ((T - 1.0) * M2V + 1.0)); };
 		    selfenergy_prefactor = ( erfc(alpha*rc)/2.0 + alpha*rc/sqrt(pc::pi) );
@@ -476,14 +475,14 @@ namespace Faunus {
 
                 void sfWolf(const Tmjson &j) {
                     alpha = j.at("alpha");
-                    table = sf.generate( [&](double q) { return (erfc(alpha*rc*q) - erfc(alpha*rc)*q); } );
+                    sf.generate( {{ [&](double q) { return (erfc(alpha*rc*q) - erfc(alpha*rc)*q); } }} );
 		    calcDielectric = [&](double M2V) { double T = erf(alpha*rc) - (2 / (3 * sqrt(pc::pi))) * exp(-alpha*alpha*rc*rc) * ( 2.0 * alpha*alpha*rc*rc + 3.0);
 						       return (((T + 2.0) * M2V + 1.0)/ ((T - 1.0) * M2V + 1.0));};
 		    selfenergy_prefactor = ( erfc(alpha*rc) + alpha*rc/sqrt(pc::pi)*(1.0 + exp(-alpha*alpha*rc2)) );
                 }
 
                 void sfPlain(const Tmjson &j, double val=1) {
-                    table = sf.generate( [&](double q) { return val; } );
+                    sf.generate( {{ [&](double q) { return val; } }} );
 		    calcDielectric = [&](double M2V) { return (2.0*M2V + 1.0)/(1.0 - M2V); };
 		    selfenergy_prefactor = 0.0;
                 }
@@ -514,7 +513,7 @@ namespace Faunus {
                         if (type=="none") sfPlain(j,0);
                         if (type=="wolf") sfWolf(j);
 
-                        if ( table.empty() )
+                        if ( sf.empty() )
                             throw std::runtime_error("unknown coulomb type '" + type + "'" );
                     }
 
@@ -529,7 +528,7 @@ namespace Faunus {
                     double operator()(const Tparticle &a, const Tparticle &b, double r2) const {
                         if (r2 < rc2) {
                             double r = sqrt(r2);
-                            return lB * a.charge * b.charge / r * sf.eval( table, r*rc1i );
+                            return lB * a.charge * b.charge / r * sf.eval( r*rc1i )[0];
                         }
                         return 0;
                     }
@@ -543,7 +542,8 @@ namespace Faunus {
                     Point force(const Tparticle &a, const Tparticle &b, double r2, const Point &p) {
                         if (r2 < rc2) {
                             double r = sqrt(r2);
-                            return lB * a.charge * b.charge * ( -sf.eval( table, r*rc1i )/r2 + sf.evalDer( table, r*rc1i )/r )*p;
+                            double q = r*rc1i;
+                            return lB * a.charge * b.charge * ( sf.eval(q)[0]/r2 - sf.evalDer(q)[0]*rc1i/r ) / r * p;
                         }
                         return Point(0,0,0);
                     }
@@ -669,8 +669,7 @@ namespace Faunus {
          */
         class DipoleDipoleGalore : public PairPotentialBase {
             private:
-                Tabulate::Andrea<double> ak, bk; // splitting function
-                Tabulate::TabulatorBase<double>::data tableA, tableB; // data for splitting function
+                Tabulate::Kernel<Tabulate::Tkernel,2> ab; // splitting functions a and b
                 std::function<double(double)> calcDielectric; // function for dielectric const. calc.
                 string type;
 		double selfenergy_prefactor;
@@ -679,8 +678,8 @@ namespace Faunus {
 
                 void sfReactionField(double epsrf_in) {
                     epsrf = epsrf_in;
-                    tableA = ak.generate( [&](double q) { return 1.0; } ); 
-		    tableB = bk.generate( [&](double q) { return -(2*(epsrf-epsr)/(2*epsrf+epsr))/epsr*q*q*q; } ); 
+                    ab.generate( {{ [&](double q) { return 1.0; },
+                                  [&](double q) { return -(2*(epsrf-epsr)/(2*epsrf+epsr))/epsr*q*q*q; } }} );
                     calcDielectric = [&](double M2V) {
                         if(epsrf > 1e10)
                             return 1 + 3*M2V;
@@ -697,8 +696,8 @@ namespace Faunus {
                 void sfQ2potential(int order_in)
                 {
                     order = order_in;
-                    tableA = ak.generate( [&](double q) { return qPochhammerSymbol(q,3,order); } );
-                    tableB = bk.generate( [&](double q) { return 0.0; } );
+                    ab.generate( {{ [&](double q) { return qPochhammerSymbol(q,3,order); },
+                                  [&](double q) { return 0.0; } }} );
 		    calcDielectric = [&](double M2V) { return (2*M2V + 1.0)/(1.0 - M2V); };
 		    selfenergy_prefactor = 0.5;
                 }
@@ -706,15 +705,15 @@ namespace Faunus {
                 void sfQpotential(int order_in)
                 {
                     order = order_in;
-                    tableA = ak.generate( [&](double q) { return _DipoleDipoleQ2Help(q,0,order); } );
-                    tableB = bk.generate( [&](double q) { return _DipoleDipoleQ2Help(q,0,order,false); } );
+                    ab.generate( {{ [&](double q) { return _DipoleDipoleQ2Help(q,0,order); },
+                                  [&](double q) { return _DipoleDipoleQ2Help(q,0,order,false); } }} );
 		    calcDielectric = [&](double M2V) { return 1 + 3*M2V; };
 		    selfenergy_prefactor = 0.5;
                 }
 
                 void sfFanourgakis() {
-                    tableA = ak.generate( [&](double q) { return ( 1.0 + 14.0*pow(q,5) - 35.0*pow(q,6) + 20.0*pow(q,7) ); } );
-                    tableB = bk.generate( [&](double q) { return 35.0*pow(q,5)*( 1.0 - 2.0*q + q*q ); } );
+                    ab.generate( {{ [&](double q) { return ( 1.0 + 14.0*pow(q,5) - 35.0*pow(q,6) + 20.0*pow(q,7) ); },
+                                  [&](double q) { return 35.0*pow(q,5)*( 1.0 - 2.0*q + q*q ); } }} );
 		    calcDielectric = [&](double M2V) { return 1 + 3*M2V; };
 		    selfenergy_prefactor = 0.0; // Seems so but is it really correct? Check!
                 }
@@ -722,8 +721,8 @@ namespace Faunus {
                 void sfFennel(double alpha_in) {
                     alpha = alpha_in;
 		    double ar = alpha*rc;
-                    tableA = ak.generate( [&](double q) { return ( ( 2.0*ar*q*exp(-ar*ar*q*q)*(2.0*ar*ar*q*q/3.0 + 1.0)/sqrt(pc::pi) + erfc(ar*q)) - (erfc(ar) + 2.0*ar*exp(-ar*ar)*(2.0*ar*ar/3.0 + 1.0)/sqrt(pc::pi))*q*q*q + q*q*q*(q-1.0)*( 3.0*erfc(ar) + 2.0*ar*exp(-ar*ar)*(3.0 + 2.0*ar*ar + 4.0/3.0*ar*ar*ar*ar)/sqrt(pc::pi))); } );
-		    tableB = bk.generate( [&](double q) { return ( 4.0/3.0*ar*ar*ar*q*q*q*exp(-ar*ar*q*q)/sqrt(pc::pi) - 4.0/3.0*ar*ar*ar*exp(-ar*ar)/sqrt(pc::pi)*q*q*q + q*q*q*(q - 1.0)*8.0/3.0*exp(-ar*ar)*pow(ar,5)/sqrt(pc::pi) ); } );
+                    ab.generate( {{ [&](double q) { return ( ( 2.0*ar*q*exp(-ar*ar*q*q)*(2.0*ar*ar*q*q/3.0 + 1.0)/sqrt(pc::pi) + erfc(ar*q)) - (erfc(ar) + 2.0*ar*exp(-ar*ar)*(2.0*ar*ar/3.0 + 1.0)/sqrt(pc::pi))*q*q*q + q*q*q*(q-1.0)*( 3.0*erfc(ar) + 2.0*ar*exp(-ar*ar)*(3.0 + 2.0*ar*ar + 4.0/3.0*ar*ar*ar*ar)/sqrt(pc::pi))); },
+                                  [&](double q) { return ( 4.0/3.0*ar*ar*ar*q*q*q*exp(-ar*ar*q*q)/sqrt(pc::pi) - 4.0/3.0*ar*ar*ar*exp(-ar*ar)/sqrt(pc::pi)*q*q*q + q*q*q*(q - 1.0)*8.0/3.0*exp(-ar*ar)*pow(ar,5)/sqrt(pc::pi) ); } }} );
 		    calcDielectric = [&](double M2V) { double T = erf(ar) - (2 / (3 * sqrt(pc::pi))) * exp(-ar*ar) * (ar*ar*ar*ar + 2.0 * ar*ar + 3.0);
 						       return (((T + 2.0) * M2V + 1.0)/ ((T - 1.0) * M2V + 1.0)); };
 		    selfenergy_prefactor = ( erfc(ar)/2.0 + ar/sqrt(pc::pi)*exp(-ar*ar) + (2.0/3.0)*ar*ar*ar/sqrt(pc::pi) );
@@ -732,16 +731,16 @@ namespace Faunus {
                 void sfWolf(double alpha_in) {
                     alpha = alpha_in;
 		    double ar = alpha*rc;
-                    tableA = ak.generate( [&](double q) { return ( ( 2.0*ar*q*exp(-ar*ar*q*q)*(2.0*ar*ar*q*q/3.0 + 1.0)/sqrt(pc::pi) + erfc(ar*q)) - (erfc(ar) + 2.0*ar*exp(-ar*ar)*(2.0*ar*ar/3.0 + 1.0)/sqrt(pc::pi))*q*q*q ); } );
-		    tableB = bk.generate( [&](double q) { return ( 4.0/3.0*ar*ar*ar*q*q*q*exp(-ar*ar*q*q)/sqrt(pc::pi) - 4.0/3.0*ar*ar*ar*exp(-ar*ar)/sqrt(pc::pi)*q*q*q ); } );
+                    ab.generate( {{ [&](double q) { return ( ( 2.0*ar*q*exp(-ar*ar*q*q)*(2.0*ar*ar*q*q/3.0 + 1.0)/sqrt(pc::pi) + erfc(ar*q)) - (erfc(ar) + 2.0*ar*exp(-ar*ar)*(2.0*ar*ar/3.0 + 1.0)/sqrt(pc::pi))*q*q*q ); },
+                                  [&](double q) { return ( 4.0/3.0*ar*ar*ar*q*q*q*exp(-ar*ar*q*q)/sqrt(pc::pi) - 4.0/3.0*ar*ar*ar*exp(-ar*ar)/sqrt(pc::pi)*q*q*q ); } }} );
 		    calcDielectric = [&](double M2V) { double T = erf(alpha*rc) - (2 / (3 * sqrt(pc::pi))) * exp(-alpha*alpha*rc*rc) * ( 2.0 * alpha*alpha*rc*rc + 3.0);
 						       return (((T + 2.0) * M2V + 1.0)/ ((T - 1.0) * M2V + 1.0));};
 		    selfenergy_prefactor = ( erfc(ar)/2.0 + ar/sqrt(pc::pi)*exp(-ar*ar) + (2.0/3.0)*ar*ar*ar/sqrt(pc::pi) );
                 }
 
                 void sfPlain(double val=1) {
-                    tableA = ak.generate( [&](double q) { return val; } );
-		    tableB = bk.generate( [&](double q) { return 0.0; } );
+                    ab.generate( {{ [&](double q) { return val; },
+                                  [&](double q) { return 0.0; } }} );
 		    calcDielectric = [&](double M2V) { return (2.0*M2V + 1.0)/(1.0 - M2V); };
 		    selfenergy_prefactor = 0.0;
                 }
@@ -758,10 +757,8 @@ namespace Faunus {
                         lB = pc::lB( epsr );
                         depsdt = j.value("depsdt", -0.368*pc::T()/epsr);
 
-                        ak.setRange(0, 1);
-                        ak.setTolerance( j.value("tab_utol",1e-9) , j.value("tab_ftol",1e-2) );
-                        bk.setRange(0, 1);
-                        bk.setTolerance( j.value("tab_utol",1e-9) , j.value("tab_ftol",1e-2) );
+                        ab.setRange(0, 1);
+                        ab.setTolerance( j.value("tab_utol",1e-9) , j.value("tab_ftol",1e-2) );
 
                         if (type=="reactionfield") sfReactionField(j.at("eps_rf"));
                         if (type=="fanourgakis") sfFanourgakis();
@@ -772,7 +769,7 @@ namespace Faunus {
                         if (type=="none") sfPlain(0);
                         if (type=="wolf") sfWolf(j.at("alpha"));
 
-                        if ( tableA.empty() )
+                        if ( ab.empty() )
                             throw std::runtime_error("unknown coulomb type '" + type + "'" );
                     }
 
@@ -795,10 +792,8 @@ namespace Faunus {
                         lB = pc::lB( epsr );
 			pc::setT(temperature);
 
-                        ak.setRange(0, 1);
-                        ak.setTolerance( tab_utol , tab_ftol );
-                        bk.setRange(0, 1);
-                        bk.setTolerance( tab_utol , tab_ftol );
+                        ab.setRange(0, 1);
+                        ab.setTolerance( tab_utol , tab_ftol );
 
                         if (type=="reactionfield") sfReactionField(parameter);
                         if (type=="fanourgakis") sfFanourgakis();
@@ -809,7 +804,7 @@ namespace Faunus {
                         if (type=="none") sfPlain(0);
                         if (type=="wolf") sfWolf(parameter);
 
-                        if ( tableA.empty() )
+                        if ( ab.empty() )
                             throw std::runtime_error("unknown coulomb type '" + type + "'" );
                     }
 
@@ -822,15 +817,73 @@ namespace Faunus {
 
                 template<class Tparticle>
                     double operator()(const Tparticle &a, const Tparticle &b, const Point &r) const {
-                        double r1 = r.norm();
-                        if (r1 < rc) {
-                            double af = ak.eval(tableA,r1*rc1i);
-                            double bf = bk.eval(tableB,r1*rc1i);
-                            return lB*mu2mu(a.mu(), b.mu(), a.muscalar()*b.muscalar(), r,af,bf);
+                        double r2 = r.squaredNorm();
+                        if (r2 < rc2) {
+                            double r1 = sqrt(r2);
+                            auto s = ab.eval(r1*rc1i);
+                            double dot = a.mu().dot(b.mu());
+                            double T = (3*a.mu().dot(r)*b.mu().dot(r)/r2 - dot)*s[0] + dot*s[1];
+                            return -lB*a.muscalar()*b.muscalar()*T/(r1*r2);
                         }
                         return 0.0;
                     }
-                    
+
+                /**
+                 * @brief Energy of `p[i]` with dipoles in `[first,last)`, skipping `i`
+                 *
+                 * Distances are gathered in batches and pairs beyond the cutoff are
+                 * removed in a vectorizable loop before the kernel lookup.
+                 */
+                template<class Tgeometry, class Tpvec>
+                    double batch(Tgeometry &geo, const Tpvec &p, int i, int first, int last) const {
+                        enum {BATCH=64};
+                        double rx[BATCH], ry[BATCH], rz[BATCH], r2[BATCH];
+                        int near[BATCH];
+                        double u = 0;
+                        const auto &a = p[i];
+                        for (int begin = first; begin < last; begin += BATCH) {
+                            int n = std::min(int(BATCH), last - begin);
+                            for (int k = 0; k < n; k++) {
+                                Point r = geo.vdist(a, p[begin + k]);
+                                rx[k] = r.x();
+                                ry[k] = r.y();
+                                rz[k] = r.z();
+                            }
+                            int m = 0;
+                            for (int k = 0; k < n; k++) {
+                                r2[k] = rx[k]*rx[k] + ry[k]*ry[k] + rz[k]*rz[k];
+                                near[m] = k;
+                                m += (r2[k] < rc2 && begin + k != i);
+                            }
+                            for (int l = 0; l < m; l++) {
+                                int k = near[l];
+                                const auto &b = p[begin + k];
+                                double r1 = sqrt(r2[k]);
+                                auto s = ab.eval(r1*rc1i);
+                                double dot = a.mu().dot(b.mu());
+                                double ra = a.mu().x()*rx[k] + a.mu().y()*ry[k] + a.mu().z()*rz[k];
+                                double rb = b.mu().x()*rx[k] + b.mu().y()*ry[k] + b.mu().z()*rz[k];
+                                u -= b.muscalar()*((3*ra*rb/r2[k] - dot)*s[0] + dot*s[1])/(r1*r2[k]);
+                            }
+                        }
+                        return lB*a.muscalar()*u;
+                    }
+
+                /**
+                 * @brief Field at `r` due to dipole `p` so that \f$ u = -\boldsymbol{\mu}_a\cdot\boldsymbol{E}_b \f$
+                 */
+                template<class Tparticle>
+                    Point field(const Tparticle &p, const Point &r) const {
+                        double r2 = r.squaredNorm();
+                        if (r2 < rc2) {
+                            double r1 = sqrt(r2);
+                            auto s = ab.eval(r1*rc1i);
+                            Point E = (3*p.mu().dot(r)*r/r2 - p.mu())*s[0] + p.mu()*s[1];
+                            return lB*p.muscalar()*E/(r1*r2);
+                        }
+                        return Point(0,0,0);
+                    }
+
                 /**
 		 * @brief Self-energy of the potential
 		 */
@@ -937,7 +990,7 @@ namespace Faunus {
                 }
                 template<class Tparticle>
                     double operator()(const Tparticle &a, const Tparticle &b, const Point &r) const {
-                        return _lB*q2quad(a.charge, b.theta,b.charge, a.theta,r);
+                        return _lB*q2quad(a.charge, b.theta(), b.charge, a.theta(), r);
                     }
 
                 template<class Tparticle>
@@ -990,8 +1043,7 @@ namespace Faunus {
                 private:
                     double kappa, cutoff, cutoff2, der;
                     bool forceshifted;
-                    Tabulate::Andrea<double> T0, T1, T2a, T2b; // splitting function
-                    Tabulate::TabulatorBase<double>::data tableT0, tableT1, tableT2a, tableT2b; // data for splitting function
+                    Tabulate::Kernel<Tabulate::Tkernel,4> T; // splitting functions T0, T1, T2a and T2b
 
                     string _brief() {
                         std::ostringstream o;
@@ -1015,21 +1067,13 @@ namespace Faunus {
                             der = 1.0;
                         double kR = kappa*cutoff;
 
-                        T0.setRange(0, 1);
-                        T0.setTolerance(in.value("tab_utol",1e-9),in.value("tab_ftol",1e-2) );
-                        tableT0 = T0.generate( [&](double q) { return ( erfc(kR*q) - q*erfc(kR) + der*q*(q - 1.0)*(erfc(kR)+2.0*kR/sqrt(pc::pi)*exp(-kR*kR)) ); } );
-
-                        T1.setRange(0, 1);
-                        T1.setTolerance(in.value("tab_utol",1e-9),in.value("tab_ftol",1e-2) );
-                        tableT1 = T1.generate( [&](double q) { return ((2.0*kR*q/sqrt(pc::pi)*exp(-kR*kR*q*q) + erfc(kR*q)) - (2.0*kR/sqrt(pc::pi)*exp(-kR*kR) + erfc(kR))*q*q + der*q*q*(q - 1.0)*2.0*( (kR/sqrt(pc::pi)*exp(-kR*kR)*(1.0/sqrt(pc::pi) + 1.0 + 2.0*kR*kR/sqrt(pc::pi)) + erfc(kR) ))); } );
-
-                        T2a.setRange(0, 1);
-                        T2a.setTolerance(in.value("tab_utol",1e-9),in.value("tab_ftol",1e-2) );
-                        tableT2a = T2a.generate( [&](double q) { return ( ( 2.0*kR*q*exp(-kR*kR*q*q)*(2.0*kR*kR*q*q/3.0 + 1.0)/sqrt(pc::pi) + erfc(kR*q)) - (erfc(kR) + 2.0*kR*exp(-kR*kR)*(2.0*kR*kR/3.0 + 1.0)/sqrt(pc::pi))*q*q*q + der*q*q*q*(q-1.0)*( 3.0*erfc(kR) + 2.0*kR*exp(-kR*kR)*(3.0 + 2.0*kR*kR + 4.0/3.0*kR*kR*kR*kR)/sqrt(pc::pi))); } );
-			
-                        T2b.setRange(0, 1);
-                        T2b.setTolerance(in.value("tab_utol",1e-9),in.value("tab_ftol",1e-2) );
-			tableT2b = T2b.generate( [&](double q) { return ( 4.0/3.0*kR*kR*kR*q*q*q*exp(-kR*kR*q*q)/sqrt(pc::pi) - 4.0/3.0*kR*kR*kR*exp(-kR*kR)/sqrt(pc::pi)*q*q*q + der*q*q*q*(q - 1.0)*8.0/3.0*exp(-kR*kR)*pow(kR,5)/sqrt(pc::pi) ); } );
+                        T.setRange(0, 1);
+                        T.setTolerance(in.value("tab_utol",1e-9),in.value("tab_ftol",1e-2) );
+                        T.generate( {{
+                                [&](double q) { return ( erfc(kR*q) - q*erfc(kR) + der*q*(q - 1.0)*(erfc(kR)+2.0*kR/sqrt(pc::pi)*exp(-kR*kR)) ); },
+                                [&](double q) { return ((2.0*kR*q/sqrt(pc::pi)*exp(-kR*kR*q*q) + erfc(kR*q)) - (2.0*kR/sqrt(pc::pi)*exp(-kR*kR) + erfc(kR))*q*q + der*q*q*(q - 1.0)*2.0*( (kR/sqrt(pc::pi)*exp(-kR*kR)*(1.0/sqrt(pc::pi) + 1.0 + 2.0*kR*kR/sqrt(pc::pi)) + erfc(kR) ))); },
+                                [&](double q) { return ( ( 2.0*kR*q*exp(-kR*kR*q*q)*(2.0*kR*kR*q*q/3.0 + 1.0)/sqrt(pc::pi) + erfc(kR*q)) - (erfc(kR) + 2.0*kR*exp(-kR*kR)*(2.0*kR*kR/3.0 + 1.0)/sqrt(pc::pi))*q*q*q + der*q*q*q*(q-1.0)*( 3.0*erfc(kR) + 2.0*kR*exp(-kR*kR)*(3.0 + 2.0*kR*kR + 4.0/3.0*kR*kR*kR*kR)/sqrt(pc::pi))); },
+                                [&](double q) { return ( 4.0/3.0*kR*kR*kR*q*q*q*exp(-kR*kR*q*q)/sqrt(pc::pi) - 4.0/3.0*kR*kR*kR*exp(-kR*kR)/sqrt(pc::pi)*q*q*q + der*q*q*q*(q - 1.0)*8.0/3.0*exp(-kR*kR)*pow(kR,5)/sqrt(pc::pi) ); } }} );
 		    }   
 
                     template<class Tparticle>
@@ -1040,21 +1084,22 @@ namespace Faunus {
 
                             double U_total = 0;
                             double r1 = sqrt(r2);
+                            auto t = T.eval( r1/cutoff ); // T0, T1, T2a, T2b
 
-                            if(useIonIon == true) U_total += a.charge * b.charge / r1 * T0.eval( tableT0, r1/cutoff );
+                            if(useIonIon == true) U_total += a.charge * b.charge / r1 * t[0];
                             if(useIonDipole == true) {
-                                double T1_temp = T1.eval( tableT1, r1/cutoff );
+                                double T1_temp = t[1];
                                 U_total += a.charge*b.muscalar()*b.mu().dot(r)/r1*T1_temp/r2;
                                 U_total += b.charge*a.muscalar()*a.mu().dot(-r)/r1*T1_temp/r2;
                             }
-                            if(useDipoleDipole == true) U_total += mu2mu(a.mu(), b.mu(), a.muscalar()*b.muscalar(), r,T2a.eval(tableT2a,r1/cutoff),T2b.eval(tableT2b,r1/cutoff));
+                            if(useDipoleDipole == true) U_total += mu2mu(a.mu(), b.mu(), a.muscalar()*b.muscalar(), r,t[2],t[3]);
                             if(useIonQuadrupole == true) {
-                                double traceA = a.theta.trace();
-                                double traceB = b.theta.trace();
-                                double crossA = r.transpose()*a.theta*r;
-                                double crossB = r.transpose()*b.theta*r;
-                                U_total += b.charge*((3*crossA/r2 - traceA)*T2a.eval(tableT2a,r1/cutoff) - traceA*T2b.eval(tableT2b,r1/cutoff))/r1/r2;
-                                U_total += a.charge*((3*crossB/r2 - traceB)*T2a.eval(tableT2a,r1/cutoff) - traceB*T2b.eval(tableT2b,r1/cutoff))/r1/r2;
+                                double traceA = a.theta().trace();
+                                double traceB = b.theta().trace();
+                                double crossA = r.transpose()*a.theta()*r;
+                                double crossB = r.transpose()*b.theta()*r;
+                                U_total += b.charge*((3*crossA/r2 - traceA)*t[2] - traceA*t[3])/r1/r2;
+                                U_total += a.charge*((3*crossB/r2 - traceB)*t[2] - traceB*t[3])/r1/r2;
                             }
                             return _lB*U_total;
                         }
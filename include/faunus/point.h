@@ -429,6 +429,9 @@ namespace Faunus
     /**
      * @brief Class for isotropic particles
      *
+     * If compiled with `FAU_SINGLEPRECISION`, charge and radius are stored
+     * in single precision while positions remain double precision.
+     *
      * Example:
      *
      * ~~~
@@ -441,8 +444,13 @@ namespace Faunus
      */
     struct PointParticle : public Point
     {
+#ifdef FAU_SINGLEPRECISION
+        typedef float Tradius;
+        typedef float Tcharge;
+#else
         typedef Point::Tcoord Tradius;
         typedef Point::Tcoord Tcharge;
+#endif
         typedef Point::Tcoord Tmw;
         typedef Point::Tcoord Talphax;
         typedef unsigned char Tid;
@@ -10,6 +10,7 @@
 #include <faunus/inputfile.h>
 #include <faunus/species.h>
 #include <faunus/average.h>
+#include <array>
 #endif
 
 namespace Faunus {
@@ -56,6 +57,14 @@ namespace Faunus {
 
     class DebyeHuckel;
 
+    /**
+     * @brief Pair energy split into inverse powers of the distance
+     *
+     * Element `n` holds the \f$ c_n r^{-n} \f$ contribution so that the
+     * energy is the sum of all elements. Powers up to twelve are supported.
+     */
+    typedef std::array<double,13> InversePowers;
+
     /**
      * @brief Base class for pair potential classes
      *
@@ -394,11 +403,13 @@ namespace Faunus {
      */
     class FENE : public PairPotentialBase {
       private:
-        double k, r02, r02inv;
-
         string _brief();
 
       public:
+        double k;      //!< Bond stiffness (kT)
+        double r02;    //!< Squared maximum separation (angstrom^2)
+        double r02inv; //!< Inverse of `r02`
+
         FENE(double k_kT, double rmax_A);
 
         FENE( Tmjson &j ) {
@@ -672,6 +683,14 @@ namespace Faunus {
             double x(r6(a.radius+b.radius,r2));
             return eps*(x*x - x);
           }
+
+        /** @brief Add energy to inverse power decomposition, see `InversePowerLaw` */
+        template<class Tparticle>
+          void inversePowers(const Tparticle &a, const Tparticle &b, double r2, InversePowers &u) const {
+            double x(r6(a.radius+b.radius,r2));
+            u[12] += eps*x*x;
+            u[6] -= eps*x;
+          }
         template<class Tparticle>
           double operator() (const Tparticle &a, const Tparticle &b, const Point &r) {
             return operator()(a,b,r.squaredNorm());
@@ -801,6 +820,7 @@ namespace Faunus {
                 std::tie( sigma, epsilon ) = mixer( {i.sigma, j.sigma}, {i.eps, j.eps} );
                 s2.set(  i.id, j.id, sigma*sigma );
                 eps.set( i.id, j.id, 4*epsilon );
+                rcut2.set( i.id, j.id, pc::infty ); // no cutoff
               }
           }
 
@@ -963,6 +983,9 @@ namespace Faunus {
           inline WeeksChandlerAndersen(const T &dummy)
           : Tbase( dummy ), onefourth(1/4.), twototwosixth(std::pow(2,2/6.))  {
             name="WeeksChandlerAnderson";
+            for (size_t i=0; i<atom.size(); i++)
+              for (size_t j=0; j<atom.size(); j++)
+                rcut2.set(i, j, s2(i,j)*twototwosixth);
           }
 
         /** @brief Energy in kT between two particles, r2 = squared distance */
@@ -1006,7 +1029,7 @@ namespace Faunus {
 
         /** @brief Energy in kT between two particles, r2 = squared distance */
         template<class Tparticle>
-          inline double operator() (const Tparticle &a, const Tparticle &b, double r2) {
+          inline double operator() (const Tparticle &a, const Tparticle &b, double r2) const {
             double d=a.radius+b.radius+threshold;
             if ( r2 < d*d )
               return -depth;
@@ -1120,6 +1143,15 @@ namespace Faunus {
             return eps*x*x;
           }
 
+        /** @brief Add energy to inverse power decomposition, see `InversePowerLaw` */
+        template<class Tparticle>
+          void inversePowers(const Tparticle &a, const Tparticle &b, double r2, InversePowers &u) const {
+            double x=(a.radius+b.radius);
+            x=x*x/r2;
+            x=x*x*x;
+            u[12] += eps*x*x;
+          }
+
         string info(char);
     };
 
@@ -1210,6 +1242,12 @@ namespace Faunus {
 #endif
         }
 
+      /** @brief Add energy to inverse power decomposition, see `InversePowerLaw` */
+      template<class Tparticle>
+        void inversePowers(const Tparticle &a, const Tparticle &b, double r2, InversePowers &u) const {
+          u[1] += lB*a.charge*b.charge / sqrt(r2);
+        }
+
       template<class Tparticle>
         double operator() (const Tparticle &a, const Tparticle &b, const Point &r) {
           return operator()(a,b,r.squaredNorm());
@@ -1974,6 +2012,45 @@ namespace Faunus {
       };
 
 
+    /**
+     * @brief Trait for pair potentials that are sums of inverse powers of the distance
+     *
+     * Pair potentials of the form \f$ u(r) = \sum_n c_n r^{-n} \f$ with no
+     * cutoff scale analytically if all distances are scaled by a factor `s`,
+     * \f$ u(sr) = \sum_n s^{-n} c_n r^{-n}\f$. For such potentials this trait
+     * is specialized with `value=true` and `add()` which adds the
+     * contributions of a particle pair to an `InversePowers` array.
+     * The trait matches the exact type only, i.e. derived potentials
+     * such as `CoulombWolf` or `LennardJonesTrunkShift` are not included.
+     */
+    template<class Tpairpot>
+      struct InversePowerLaw {
+        static const bool value = false;
+      };
+
+    template<class Tpairpot>
+      struct InversePowerLawBase {
+        static const bool value = true;
+        template<class Tparticle>
+          static void add(const Tpairpot &pot, const Tparticle &a, const Tparticle &b, double r2, InversePowers &u) {
+            pot.inversePowers(a,b,r2,u);
+          }
+      };
+
+    template<> struct InversePowerLaw<LennardJones> : public InversePowerLawBase<LennardJones> {};
+    template<> struct InversePowerLaw<R12Repulsion> : public InversePowerLawBase<R12Repulsion> {};
+    template<> struct InversePowerLaw<Coulomb> : public InversePowerLawBase<Coulomb> {};
+
+    template<class T1, class T2>
+      struct InversePowerLaw<CombinedPairPotential<T1,T2>> {
+        static const bool value = InversePowerLaw<T1>::value && InversePowerLaw<T2>::value;
+        template<class Tparticle>
+          static void add(const CombinedPairPotential<T1,T2> &pot, const Tparticle &a, const Tparticle &b, double r2, InversePowers &u) {
+            InversePowerLaw<T1>::add(pot.first,a,b,r2,u);
+            InversePowerLaw<T2>::add(pot.second,a,b,r2,u);
+          }
+      };
+
     /**
      * @brief Adds two pair potentials
      *
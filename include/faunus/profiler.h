@@ -0,0 +1,257 @@
+#ifndef FAUNUS_PROFILER_H
+#define FAUNUS_PROFILER_H
+
+#ifndef SWIG
+#include <faunus/common.h>
+#include <faunus/json.h>
+#include <chrono>
+#include <thread>
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace Faunus
+{
+
+  /**
+   * @brief Hierarchical profiling of moves and energy evaluations
+   *
+   * Collects the number of calls, pair evaluations and wall time
+   * (nanoseconds) attributed to the currently running move, energy term
+   * and energy method (`i2all`, `g2g`, `external`, ...). Energy terms are
+   * timed when called through `Energy::Hamiltonian` or a combined energy
+   * (`operator+`) and nested terms are stored with their full path, i.e.
+   * `Hamiltonian/Nonbonded`. In addition, the phases of each move (trial
+   * move, energy change, accept/reject and update) are timed so that time
+   * spent outside the Hamiltonian, i.e. in `Group::rotate`, can be
+   * identified. Results are written to `move_out.json` by the moves.
+   *
+   * The profiler is compiled in only if `FAU_PROFILE` is defined (cmake
+   * option `ENABLE_PROFILING`); otherwise the `FAU_PROFILE_*` macros
+   * expand to plain function calls and there is no run-time cost.
+   *
+   * @note Pair level functions (`p2p`, `f_p2p`) are not timed as the timer
+   *       overhead would dominate; they are instead counted as pair evaluations
+   *       by the energy terms that support it.
+   * @note Only the thread that first used the profiler records data and
+   *       nothing is recorded inside OpenMP parallel regions, i.e. work done by
+   *       parallel moves is not attributed. This avoids locking on every call.
+   */
+  class Profiler
+  {
+  public:
+      struct Data
+      {
+          unsigned long long calls, pairs;
+          std::chrono::nanoseconds time;
+
+          Data() : calls(0), pairs(0), time(0) {}
+
+          Tmjson json() const
+          {
+              return {{"calls", calls}, {"pairs", pairs}, {"time (ns)", time.count()}};
+          }
+      };
+
+      typedef std::map<string, Data> Tmethods;   // method -> data
+      typedef std::map<string, Tmethods> Tterms; // term path -> methods
+
+  private:
+      typedef std::chrono::steady_clock Tclock;
+
+      struct MoveData
+      {
+          Tterms terms;
+          Tmethods phases;
+      };
+
+      std::map<string, MoveData> moves;
+      MoveData *current;              // data for currently running move
+      string move;                    // name of currently running move
+      string path;                    // path of currently evaluated energy term
+      unsigned long long pairs;       // running count of pair evaluations
+      std::thread::id owner;          // only this thread records
+
+      Profiler() : current(&moves["other"]), move("other"), pairs(0), owner(std::this_thread::get_id()) {}
+
+  public:
+      static Profiler &instance()
+      {
+          static Profiler p;
+          return p;
+      }
+
+      /** @brief True if the calling thread may record */
+      bool recording() const
+      {
+#ifdef _OPENMP
+          if ( omp_in_parallel())
+              return false;
+#endif
+          return std::this_thread::get_id() == owner;
+      }
+
+      /** @brief Register `n` pair evaluations */
+      inline void addPairs( unsigned long long n )
+      {
+          if ( recording())
+              pairs += n;
+      }
+
+      /** @brief Attribute all events to move `name` for the lifetime of the object */
+      class MoveScope
+      {
+          string prev;
+          bool active;
+      public:
+          MoveScope( const string &name ) : active(instance().recording())
+          {
+              if ( active )
+              {
+                  auto &p = instance();
+                  prev = p.move;
+                  p.move = name;
+                  p.current = &p.moves[name];
+              }
+          }
+
+          ~MoveScope()
+          {
+              if ( active )
+              {
+                  auto &p = instance();
+                  p.move = prev;
+                  p.current = &p.moves[prev];
+              }
+          }
+      };
+
+      /** @brief Time energy term method for the lifetime of the object; unnamed terms are ignored */
+      class TermScope
+      {
+          string prevpath;
+          const char *method;
+          unsigned long long pairs0;
+          Tclock::time_point t0;
+          bool active;
+      public:
+          TermScope( const string &term, const char *method ) :
+              method(method), active(!term.empty() && instance().recording())
+          {
+              if ( active )
+              {
+                  auto &p = instance();
+                  prevpath = p.path;
+                  p.path = prevpath.empty() ? term : prevpath + "/" + term;
+                  pairs0 = p.pairs;
+                  t0 = Tclock::now();
+              }
+          }
+
+          ~TermScope()
+          {
+              if ( active )
+              {
+                  auto &p = instance();
+                  auto &d = p.current->terms[p.path][method];
+                  d.time += std::chrono::duration_cast<std::chrono::nanoseconds>(Tclock::now() - t0);
+                  d.pairs += p.pairs - pairs0;
+                  d.calls++;
+                  p.path = prevpath;
+              }
+          }
+      };
+
+      /** @brief Time move phase for the lifetime of the object */
+      class PhaseScope
+      {
+          const char *phase;
+          unsigned long long pairs0;
+          Tclock::time_point t0;
+          bool active;
+      public:
+          PhaseScope( const char *phase ) : phase(phase), pairs0(0), active(instance().recording())
+          {
+              if ( active )
+              {
+                  pairs0 = instance().pairs;
+                  t0 = Tclock::now();
+              }
+          }
+
+          ~PhaseScope()
+          {
+              if ( active )
+              {
+                  auto &p = instance();
+                  auto &d = p.current->phases[phase];
+                  d.time += std::chrono::duration_cast<std::chrono::nanoseconds>(Tclock::now() - t0);
+                  d.pairs += p.pairs - pairs0;
+                  d.calls++;
+              }
+          }
+      };
+
+      /** @brief Call `f` and attribute it to energy term and method */
+      template<class Tfunc>
+      static auto call( const string &term, const char *method, Tfunc f ) -> decltype(f())
+      {
+          TermScope s(term, method);
+          return f();
+      }
+
+      /** @brief Profile of a single move as JSON object */
+      Tmjson json( const string &name ) const
+      {
+          Tmjson j;
+          auto it = moves.find(name);
+          if ( it != moves.end())
+          {
+              for ( auto &t : it->second.terms )
+                  for ( auto &m : t.second )
+                      j["terms"][t.first][m.first] = m.second.json();
+              for ( auto &m : it->second.phases )
+                  j["phases"][m.first] = m.second.json();
+          }
+          return j;
+      }
+
+      /** @brief Profile of all moves as JSON object */
+      Tmjson json() const
+      {
+          Tmjson j;
+          for ( auto &m : moves )
+          {
+              auto js = json(m.first);
+              if ( !js.is_null())
+                  j[m.first] = js;
+          }
+          return j;
+      }
+
+      void clear()
+      {
+          moves.clear();
+          current = &moves[move];
+          pairs = 0;
+      }
+  };
+
+}//namespace
+
+#ifdef FAU_PROFILE
+#define FAU_PROFILE_MOVE(name) Faunus::Profiler::MoveScope _fau_profile_move(name)
+#define FAU_PROFILE_PHASE(name) Faunus::Profiler::PhaseScope _fau_profile_phase(name)
+#define FAU_PROFILE_PAIRS(n) Faunus::Profiler::instance().addPairs(n)
+#define FAU_PROFILE_CALL(term, method, ...) \
+    Faunus::Profiler::call((term).name, #method, [&]() { return (term).method(__VA_ARGS__); })
+#else
+#define FAU_PROFILE_MOVE(name)
+#define FAU_PROFILE_PHASE(name)
+#define FAU_PROFILE_PAIRS(n)
+#define FAU_PROFILE_CALL(term, method, ...) (term).method(__VA_ARGS__)
+#endif
+
+#endif
@@ -29,7 +29,12 @@ namespace Faunus
    * of a data element can exist at any given time.
    *
    * Internally, the structure is a map of `Tid` key and
-   * a vector of `T`.
+   * a vector of `T`. The position of each element in its vector
+   * is indexed so that `insert()`, `erase()` and `exists()` run
+   * in constant time. If the vectors are modified directly via
+   * `operator[]` or `getMap()`, the index must be restored with
+   * `reindex()`. Shifted particle indices are updated with `shift()`
+   * which scans all elements, i.e. O(N), and re-indexes only the affected ones.
    *
    * Example:
    *
@@ -59,7 +64,19 @@ namespace Faunus
   {
   private:
       std::map<Tid, std::vector<T> > _map;
+      std::unordered_map<T, size_t> _pos;   // position of data in its `_map` vector
       std::map<Tid, Average<double> > Navg; // average vector length. TO BE REMOVED
+
+      /** @brief Position of data in `v` or `v.size()` if not found */
+      size_t locate( const std::vector<T> &v, T data ) const
+      {
+          auto h = _pos.find(data);
+          if ( h != _pos.end())
+              if ( h->second < v.size() && v[h->second] == data )
+                  return h->second;
+          return v.size();
+      }
+
   public:
       /** @brief Number of elements of type id */
       size_t size( Tid id ) const
@@ -95,7 +112,43 @@ namespace Faunus
 
 
       /** @brief Clear map -- preserve averages */
-      void clear() { _map.clear(); }
+      void clear()
+      {
+          _map.clear();
+          _pos.clear();
+      }
+
+      /** @brief Rebuild position index after direct modification of the vectors */
+      void reindex()
+      {
+          _pos.clear();
+          for ( auto &m : _map )
+              for ( size_t k = 0; k < m.second.size(); k++ )
+                  _pos[m.second[k]] = k;
+      }
+
+      /**
+       * @brief Add `delta` to all data greater than or equal to `first`
+       *
+       * Used to follow particle indices when particles are inserted or
+       * erased in the middle of the particle vector. Vector positions are
+       * unchanged and only the index of shifted data is updated, but all
+       * data is scanned so the cost is linear in the number of elements.
+       */
+      void shift( T first, T delta )
+      {
+          std::vector<std::pair<T, size_t> > moved;
+          for ( auto &m : _map )
+              for ( size_t k = 0; k < m.second.size(); k++ )
+                  if ( m.second[k] >= first )
+                  {
+                      _pos.erase(m.second[k]);
+                      m.second[k] += delta;
+                      moved.push_back({m.second[k], k});
+                  }
+          for ( auto &i : moved ) // re-add after all old keys are removed
+              _pos[i.first] = i.second;
+      }
 
       /** @brief Update average number of particles. TO BE REMOVED. */
       void updateAvg()
@@ -115,6 +168,7 @@ namespace Faunus
           for ( size_t i = 0; i < p.size(); i++ )
               if ( atom[p[i].id].activity > 1e-6 )
                   _map[p[i].id].push_back(i);
+          reindex();
       }
 
       /**
@@ -150,15 +204,12 @@ namespace Faunus
        */
       void insert( Tid id, T data )
       {
-          auto i = _map.find(id);
-          if ( i != _map.end())
+          auto &v = _map[id];
+          if ( locate(v, data) == v.size())
           {
-              auto pos = std::find(i->second.begin(), i->second.end(), data);
-              if ( pos == i->second.end())
-                  i->second.push_back(data);
+              _pos[data] = v.size();
+              v.push_back(data);
           }
-          else
-              _map[id].push_back(data);
       }
 
       /**
@@ -171,11 +222,14 @@ namespace Faunus
           auto i = _map.find(id);
           if ( i != _map.end())
           {
-              auto pos = std::find(i->second.begin(), i->second.end(), data);
-              if ( pos != i->second.end())
+              auto &v = i->second;
+              size_t k = locate(v, data);
+              if ( k != v.size())
               {
-                  std::swap(*pos, i->second.back());
-                  i->second.pop_back();
+                  v[k] = v.back();
+                  _pos[v[k]] = k;
+                  v.pop_back();
+                  _pos.erase(data);
                   return true;
               }
           }
@@ -184,19 +238,13 @@ namespace Faunus
       }
 
       /**
-       * @brief Erase data using search (slower than using id)
+       * @brief Erase data using search over all id's (slower than using id)
        */
       bool erase( T data )
       {
           for ( auto &m : _map )
-          {
-              auto it = std::find(m.second.begin(), m.second.end(), data);
-              if ( it != m.second.end())
-              {
-                  m.second.erase(it);
-                  return true;
-              }
-          }
+              if ( locate(m.second, data) != m.second.size())
+                  return erase(m.first, data);
           std::cerr << "Warning: Nothing to erase.\n";
           return false;
       }
@@ -206,11 +254,7 @@ namespace Faunus
       {
           auto i = _map.find(id);
           if ( i != _map.end())
-          {
-              auto pos = std::find(i->second.begin(), i->second.end(), data);
-              if ( pos != i->second.end())
-                  return true;
-          }
+              return locate(i->second, data) != i->second.size();
           return false;
       }
 
@@ -242,7 +286,8 @@ namespace Faunus
    * 4. `MoleculeMap` is initialized with data found in JSON section
    *    `atomlist`. If `MoleculeData::Ninit` is given, molecules will be
    *    inserted into the simulation container, respecting
-   *    boundary conditions.
+   *    boundary conditions. Use the `bulkinsert` keyword to also
+   *    avoid particle overlap, see `BulkInserter`.
    *
    * @tparam Tgeometry Simulation container geometry derived from `Geometry::Geometrybase`
    * @tparam Tparticle Particle type based on `PointParticle`
@@ -253,8 +298,20 @@ namespace Faunus
   private:
       bool checkSanity();                    //!< Check group length and vector sync
       std::vector<Group *> g;                 //!< Pointers to ALL groups in the system
+      std::vector<int> gindex;               //!< Particle index -> index in `g` (-1 if not grouped)
+      bool ownsGroups = false;               //!< True if groups are deleted upon destruction (copies only)
       Tmjson to_json();
 
+      /** @brief Rebuild particle to group lookup table -- O(N) */
+      void updateGroupIndex()
+      {
+          gindex.assign(p.size(), -1);
+          for ( int k = int(g.size()) - 1; k >= 0; k-- ) // reverse so that first matching group wins
+              for ( auto i : *g[k] )
+                  if ( i >= 0 && i < int(gindex.size()))
+                      gindex[i] = k;
+      }
+
   public:
       typedef std::vector<Tparticle, Eigen::aligned_allocator<Tparticle> > p_vec;
       typedef p_vec ParticleVector;          //!< Particle vector type
@@ -292,7 +349,7 @@ namespace Faunus
           std::map<int, vector<int>> rmGroup; // remove groups
           std::map<int, ParticleVector> inGroup; // insert groups
 
-          Change() : dV(0) {};
+          Change() : dV(0), geometryChange(false) {};
 
           void clear()
           {
@@ -359,8 +416,12 @@ namespace Faunus
           atom.include( j.at("atomlist") );
           molecule.include( j.at("moleculelist") );
           for ( auto mol : molecule )
-              while ( mol.Ninit-- > 0 )
-                  insert(mol.id, mol.getRandomConformation(geo, p));
+              if ( mol.bulkInserter.method == BulkInserter<p_vec>::Method::NONE )
+                  while ( mol.Ninit-- > 0 )
+                      insert(mol.id, mol.getRandomConformation(geo, p));
+              else
+                  for ( auto &v : mol.getRandomConformations(geo, p, mol.Ninit) )
+                      insert(mol.id, v);
           initTracker();
       }
       catch (std::exception &e)
@@ -369,6 +430,34 @@ namespace Faunus
           throw;
       }
 
+      /**
+       * @brief Copy constructor
+       *
+       * Groups are deep copied so that the new instance can be
+       * modified independently of the original, i.e. by a worker
+       * thread. Trackers are rebuilt to point to the new groups.
+       * The copy owns and eventually deletes all groups in its
+       * `groupList()` whereas the original may also refer to groups
+       * allocated elsewhere.
+       */
+      Space( const Space &o ) : geo(o.geo), geo_trial(o.geo_trial), p(o.p), trial(o.trial), molecule(o.molecule)
+      {
+          ownsGroups = true;
+          g.reserve(o.g.size());
+          for ( auto i : o.g )
+              g.push_back(new Group(*i));
+          initTracker();
+      }
+
+      Space &operator=( const Space & ) = delete;
+
+      ~Space()
+      {
+          if ( ownsGroups )
+              for ( auto i : g )
+                  delete i;
+      }
+
       AtomMap &atomList() { return atom; } //!< Vector of atoms
 
       MoleculeMap<ParticleVector> &molList() { return molecule; } //!< Vector of molecules
@@ -410,21 +499,46 @@ namespace Faunus
               for ( auto i : *g )
                   atomTrack.insert(p.at(i).id, i);
           }
+          updateGroupIndex();
       }
 
       /**
        * @brief Find which group given particle index belongs to.
        *
-       * If not found, `nullptr` is returned.
+       * If not found, `nullptr` is returned. The lookup table is
+       * maintained by `insert()`, `erase()` and `eraseGroup()` and
+       * if groups have been modified elsewhere, a linear search is
+       * used as fallback.
        */
       inline Group *findGroup( int i )
       {
+          if ( i >= 0 && i < int(gindex.size()))
+          {
+              int k = gindex[i];
+              if ( k >= 0 && k < int(g.size()))
+                  if ( g[k]->find(i))
+                      return g[k];
+          }
           for ( auto g : groupList())
               if ( g->find(i))
                   return g;
           return nullptr;
       }
 
+      /**
+       * @brief Index of the particle that `erase(i)` moves into position `i`
+       *
+       * For particles in atomic groups this is the last particle of the
+       * group; otherwise `i` is returned and later particles are shifted down.
+       */
+      inline int eraseSource( int i )
+      {
+          Group *gi = findGroup(i);
+          if ( gi != nullptr && gi->isAtomic())
+              return gi->back();
+          return i;
+      }
+
       /**
        * @brief Find group index for given group pointer.
        *
@@ -432,6 +546,16 @@ namespace Faunus
        */
       inline int findIndex( Group *group )
       {
+          if ( group != nullptr && !group->empty())
+          {
+              int i = group->front();
+              if ( i >= 0 && i < int(gindex.size()))
+              {
+                  int k = gindex[i];
+                  if ( k >= 0 && k < int(g.size()) && g[k] == group )
+                      return k;
+              }
+          }
           auto it = std::find(g.begin(), g.end(), group);
           return (it != g.end()) ? it - g.begin() : -1;
       }
@@ -461,12 +585,20 @@ namespace Faunus
       /** @brief Returns pointer to random molecule of type `molid` */
       inline Group *randomMol( int molId )
       {
-          auto v = findMolecules(molId);
+          auto &v = molecules(molId);
           if ( !v.empty())
               return *slump.element(v.begin(), v.end());
           return nullptr;
       }
 
+      /**
+       * @brief Reference to molecules with matching molid
+       *
+       * Same as `findMolecules()` but without copying. The vector is
+       * owned by `molTrack` and is invalidated by insertions and deletions.
+       */
+      inline const std::vector<Group *> &molecules( int molId ) { return molTrack[molId]; }
+
       /** @brief Returns vector of molecules with matching molid */
       inline std::vector<Group *> findMolecules( int molId, bool sort = false ) const
       {
@@ -615,11 +747,9 @@ namespace Faunus
           trial.insert(trial.begin() + i, a);
       }
 
-      // push forward all index > i in atom tracker
-      for ( auto &m : atomTrack.getMap() )    // loop over all maps
-          for ( auto &j : m.second ) // and their particle index
-              if ( j >= i )
-                  j++; // push forward particles beyond inserted particle
+      // push forward all index >= i in atom tracker
+      if ( i < (int) p.size() - 1 )
+          atomTrack.shift(i, 1);
 
       atomTrack.insert(a.id, i);
 
@@ -630,10 +760,20 @@ namespace Faunus
           if ( gj->back() >= i )
               gj->setback(gj->back() + 1);    //gj->last++; // +1 is a special case for adding to the end of p-vector
       }
+      updateGroupIndex();
       return true;
   }
 
-  /** @brief Erase i'th particle */
+  /**
+   * @brief Erase i'th particle
+   *
+   * If the particle belongs to an atomic group, the last particle of that
+   * group is moved into position `i` so that only a single slot at the end
+   * of the group is vacated, see `eraseSource()`. If the group is the last
+   * in the particle vector, this is done in constant time. Otherwise later
+   * particles and groups are shifted down and the atom tracker and group
+   * lookup table are updated which is O(N). Empty groups are removed.
+   */
   template<class Tgeometry, class Tparticle>
   bool Space<Tgeometry, Tparticle>::erase( int i )
   {
@@ -642,6 +782,41 @@ namespace Faunus
       if ( i < (int) p.size())
       {
           atomTrack.erase(p[i].id, i);
+
+          int j = eraseSource(i);
+          if ( j != i )
+          { // fill hole with last particle of atomic group
+              atomTrack.erase(p[j].id, j);
+              atomTrack.insert(p[j].id, i);
+              p[i] = p[j];
+              trial[i] = trial[j];
+              i = j;
+          }
+
+          if ( i == (int) p.size() - 1 )
+          { // last slot -- only the owning group changes
+              p.pop_back();
+              trial.pop_back();
+              Group *gj = findGroup(i);
+              if ( gj != nullptr )
+              {
+                  gj->setback(gj->back() - 1);
+                  if ( gj->empty())
+                  { // remove empty group
+                      molTrack.erase(gj->molId, gj);
+                      g.erase(g.begin() + findIndex(gj));
+                      delete (gj);
+                      updateGroupIndex();
+                      return true;
+                  }
+              }
+              if ( gindex.size() == p.size() + 1 )
+                  gindex.pop_back();
+              else
+                  updateGroupIndex();
+              return true;
+          }
+
           p.erase(p.begin() + i);
           trial.erase(trial.begin() + i);
 
@@ -664,11 +839,9 @@ namespace Faunus
           }
 
           // down-shift all particle index above i
-          for ( auto &m : atomTrack.getMap() )
-              for ( auto &j : m.second )
-                  if ( j > i )
-                      j--;
+          atomTrack.shift(i + 1, -1);
 
+          updateGroupIndex();
           return true;
       }
       return false;
@@ -676,11 +849,13 @@ namespace Faunus
 
   /**
    * This will remove the specified group (given as index in `groupList()`)
-   * from the space. Later groups will be shuffled down.
-   * The group pointer in `groupList` will be destructed.
+   * from the space. The group pointer in `groupList` will be destructed.
    *
-   * @todo Optimize by swapping groups of similar size to delete always at
-   * the end of `g`.
+   * If the last group in both `groupList()` and the particle vector is a
+   * different molecule of the same type and size, its particles are moved
+   * into the vacated range and it takes the place of the erased group in
+   * `groupList()`. This costs O(group size) and pointers to the moved group
+   * remain valid. Otherwise later groups are shuffled down which is O(N).
    */
   template<class Tgeometry, class Tparticle>
   bool Space<Tgeometry, Tparticle>::eraseGroup( int i )
@@ -704,6 +879,29 @@ namespace Faunus
           for ( auto j : *g[i] )
               atomTrack.erase(p[j].id, j);
 
+          Group *last = g.back();
+          if ( last != g[i] && last->molId == g[i]->molId && last->size() == n
+              && last->back() == (int) p.size() - 1 && !last->isAtomic())
+          { // move last molecule into the vacated range
+              for ( int k = 0; k < n; k++ )
+              {
+                  int src = last->front() + k;
+                  atomTrack.erase(p[src].id, src);
+                  p[beg + k] = p[src];
+                  trial[beg + k] = trial[src];
+                  atomTrack.insert(p[beg + k].id, beg + k);
+              }
+              last->setrange(beg, end);
+              delete (g[i]);
+              g[i] = last;
+              g.pop_back();
+              p.resize(p.size() - n);
+              trial.resize(trial.size() - n);
+              gindex.resize(p.size()); // vacated range already maps to `i`
+              assert(atomTrack.size() == p.size());
+              return true;
+          }
+
           // erase particle index of later groups from tracker
           for ( auto gi : groupList())
               if ( gi->front() > end )
@@ -727,6 +925,7 @@ namespace Faunus
               }
 
           assert(atomTrack.size() == p.size());
+          updateGroupIndex();
           return true;
       }
       return false;
@@ -942,6 +1141,9 @@ namespace Faunus
    * the particles are added to the end of the `p` and `trial`.
    *
    * During addition, the atom- and molecule trackers are being updated.
+   * This costs O(inserted particles) when appending to the end of the particle
+   * vector; inserting into an atomic group followed by other groups shifts
+   * these and is O(N).
    *
    * @param molId Molecule ID as defined by the `MoleculeMap`
    * @param pin Particle vector to insert
@@ -969,31 +1171,33 @@ namespace Faunus
               if ( imax >= 0 )
               {
                   // add to particle vectors
-                  p.insert(p.begin() + g[imax]->back() + 1, pin.begin(), pin.end());
-                  trial.insert(trial.begin() + g[imax]->back() + 1, pin.begin(), pin.end());
-                  g[imax]->setback(g[imax]->back() + pin.size());
+                  int last = g[imax]->back();
+                  p.insert(p.begin() + last + 1, pin.begin(), pin.end());
+                  trial.insert(trial.begin() + last + 1, pin.begin(), pin.end());
+                  g[imax]->setback(last + pin.size());
 
-                  // push forward groups above
+                  // push forward groups above; old index `ndx` now holds particle `ndx+size`
                   for ( auto i : g )
-                  {
-                      if ( *i > *g[imax] )
-                      {
-                          // erase index from atom tracker
+                      if ( i->front() > last )
                           for ( auto ndx : *i )
-                              atomTrack.erase(p[ndx].id, ndx);
-                          // shift upwards
+                              atomTrack.erase(p[ndx + pin.size()].id, ndx);
+                  for ( auto i : g )
+                      if ( i->front() > last )
+                      {
                           i->shift(pin.size());
-                          // add updated index to atom tracker
                           for ( auto ndx : *i )
                               atomTrack.insert(p[ndx].id, ndx);
                       }
-                  }
-                  // add to atom tracker
-                  for ( auto i : *g[imax] )
+                  // add new particles to atom tracker
+                  for ( int i = last + 1; i <= g[imax]->back(); i++ )
                       atomTrack.insert(p[i].id, i);
 
                   assert(atomTrack.size() == p.size());
 
+                  if ( g[imax]->back() == (int) p.size() - 1 && gindex.size() + pin.size() == p.size())
+                      gindex.resize(p.size(), imax); // appended to last group
+                  else
+                      updateGroupIndex();
                   return g[imax];
               }
           }
@@ -1023,6 +1227,11 @@ namespace Faunus
 
           x->setMassCenter(*this);
 
+          if ( gindex.size() + pin.size() == p.size())
+              gindex.resize(p.size(), int(g.size()) - 1); // new group is last in `g` and `p`
+          else
+              updateGroupIndex();
+
           return x;
       }
       return nullptr;
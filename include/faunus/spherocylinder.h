@@ -680,29 +680,84 @@ namespace Faunus
         return f;
     }
 
+    /**
+     * @brief Per-type spherocylinder half lengths and interaction ranges in flat arrays
+     *
+     * Two spherocylinders with half lengths \f$l_i,l_j\f$ and a pair potential
+     * cutoff \f$r_c\f$ cannot interact if their centers are further apart than
+     * \f$l_i+l_j+r_c\f$ since the segment-segment distance is never shorter.
+     * Half lengths are taken from `AtomData::half_len`. Type pairs without a
+     * cutoff (zero) are never rejected.
+     */
+    class CigarRange
+    {
+    private:
+        size_t n;                   // number of atom types
+        std::vector<double> halfl;  // half length of each type
+        std::vector<double> range2; // squared center-center range, n*n
+    public:
+        CigarRange() : n(0) {}
+
+        /** @brief Set ranges from squared cutoffs, `rc2(i,j)` */
+        template<class Tfunc>
+        void set( Tfunc rc2 )
+        {
+            n = atom.size();
+            halfl.resize(n);
+            for ( size_t i = 0; i < n; i++ )
+                halfl[i] = atom[i].half_len;
+            range2.assign(n * n, pc::infty);
+            for ( size_t i = 0; i < n; i++ )
+                for ( size_t j = 0; j < n; j++ )
+                {
+                    double r2 = rc2(i, j);
+                    if ( r2 > 0 )
+                        range2[i * n + j] = std::pow(halfl[i] + halfl[j] + std::sqrt(r2), 2);
+                }
+        }
+
+        /** @brief Half length of type `id` */
+        double halflength( size_t id ) const { return halfl[id]; }
+
+        /** @brief Squared center-center distance beyond which types `i` and `j` do not interact */
+        double operator()( size_t i, size_t j ) const
+        {
+            assert(i < n && j < n);
+            return range2[i * n + j];
+        }
+
+        /** @brief True if a pair of types `i` and `j` at squared center distance `r2` cannot interact */
+        bool far( size_t i, size_t j, double r2 ) const { return r2 > operator()(i, j); }
+    };
+
     /** @brief Hard pair potential for spherocylinders */
     class HardSpheroCylinder : public PairPotentialBase
     {
     private:
         string _brief() { return name; };
         Geometry::Geometrybase *geoPtr;
+        CigarRange range;
     public:
-        struct prop
-        {
-            double halfl;
-        };
-
-        std::map<CigarParticle::Tid, prop> m;
-
-        HardSpheroCylinder( Tmjson &j )
+        HardSpheroCylinder( Tmjson &j ) : geoPtr(nullptr)
         {
             name = "HardspheroCylinder";
+            for ( size_t i = 0; i < atom.size(); i++ )
+                for ( size_t k = 0; k < atom.size(); k++ )
+                    rcut2.set(i, k, std::pow(atom[i].radius + atom[k].radius, 2));
+            range.set([&]( size_t i, size_t k ) { return rcut2(i, k); });
         }
 
+        template<class Tspace>
+        void setSpace( Tspace &s ) { geoPtr = &s.geo; }
+
         inline double operator()( const CigarParticle &p1, const CigarParticle &p2, double r2 )
         {
+            if ( range.far(p1.id, p2.id, r2))
+                return 0;
+            assert(geoPtr != nullptr && "Call setSpace() before use");
             Point r_cm = geoPtr->vdist(p1, p2);
-            Point distvec = Geometry::mindist_segment2segment(p1.dir, m[p1.id].halfl, p2.dir, m[p2.id].halfl, r_cm);
+            Point distvec = Geometry::mindist_segment2segment(
+                p1.dir, range.halflength(p1.id), p2.dir, range.halflength(p2.id), r_cm);
             double mindist = p1.radius + p2.radius;
             if ( distvec.dot(distvec) < mindist * mindist )
                 return pc::infty;
@@ -734,9 +789,11 @@ namespace Faunus
 
     public:
         Tcigarsphere pairpot;
+        CigarRange range; //!< Center-center range for pre-rejection
 
         PatchyCigarSphere( Tmjson &j ) : pairpot(j)
         {
+            range.set([&]( size_t i, size_t k ) { return pairpot.rcut2(i, k); });
         }
 
         double operator()( const CigarParticle &a, const CigarParticle &b, const Point &r_cm )
@@ -745,6 +802,9 @@ namespace Faunus
             //b is sphere, a is spherocylinder
             double s, t, f0, f1, contt;
 
+            if ( range.far(a.id, b.id, r_cm.squaredNorm()))
+                return 0;
+
             assert(a.halfl < 1e-6 && "First (a) should be cigar then sphere, not opposite!");
             double c = a.dir.dot(r_cm);
             if ( c > a.halfl )
@@ -764,6 +824,9 @@ namespace Faunus
 
             //patchy interaction
             double rcut2 = pairpot.first.rcut2(a.id, b.id);
+            double ndistsq = distvec.dot(distvec);
+            if ( ndistsq >= rcut2 )
+                return pairpot.second(a, b, ndistsq); // outside patch cutoff
             // scaling function: angular dependence of patch1
             Point vec1 = Geometry::vec_perpproject(distvec, a.dir);
             vec1.normalize();
@@ -771,7 +834,6 @@ namespace Faunus
             f1 = fanglscale(s, a);
 
             // scaling function for the length of spherocylinder within cutoff
-            double ndistsq = distvec.dot(distvec);
             t = sqrt(rcut2 - ndistsq);//TODO cutoff
             if ( contt + t > a.halfl )
                 f0 = a.halfl;
@@ -812,13 +874,17 @@ namespace Faunus
 
     public:
         Tcigarcigar pairpot;
+        CigarRange range; //!< Center-center range for pre-rejection
 
         PatchyCigarCigar( Tmjson &j ) : pairpot(j)
         {
+            range.set([&]( size_t i, size_t k ) { return pairpot.rcut2(i, k); });
         }
 
         double operator()( const CigarParticle &a, const CigarParticle &b, const Point &r_cm )
         {
+            if ( range.far(a.id, b.id, r_cm.squaredNorm()))
+                return 0;
             //0- isotropic, 1-PSC all-way patch,2 -CPSC cylindrical patch
             if ( atom[a.id].patchtype > 0 )
             {
@@ -958,6 +1024,10 @@ namespace Faunus
                 + pairpot_cs.brief();
         }
 
+        CigarRange range; // center-center range of all type pairs
+
+        enum { BATCH = 64 }; // pairs per batch
+
     public:
         Tspheresphere pairpot_ss;
         PatchyCigarCigar<Tcigarcigar> pairpot_cc;
@@ -966,6 +1036,56 @@ namespace Faunus
         CigarSphereSplit( Tmjson &j ) : pairpot_ss(j), pairpot_cc(j), pairpot_cs(j)
         {
             name = "CigarSphereSplit";
+            range.set([&]( size_t i, size_t k ) {
+                bool sphere_i = atom[i].half_len < 1e-6, sphere_k = atom[k].half_len < 1e-6;
+                if ( sphere_i && sphere_k )
+                    return pairpot_ss.rcut2(i, k);
+                if ( sphere_i || sphere_k )
+                    return pairpot_cs.pairpot.rcut2(i, k);
+                return pairpot_cc.pairpot.rcut2(i, k);
+            });
+        }
+
+        /**
+         * @brief Energy of `p[i]` with particles in `[first,last)`, skipping `i`
+         *
+         * Center-center distance vectors are gathered in batches of
+         * structure-of-arrays and pairs beyond `CigarRange` are rejected in a
+         * single, vectorizable loop. The full pair potential is called for
+         * the remaining pairs only.
+         */
+        template<class Tgeometry, class Tpvec>
+        double batch( Tgeometry &geo, const Tpvec &p, int i, int first, int last )
+        {
+            double rx[BATCH], ry[BATCH], rz[BATCH], lim[BATCH];
+            int near[BATCH];
+            double u = 0;
+            const auto &a = p[i];
+            for ( int begin = first; begin < last; begin += BATCH )
+            {
+                int n = std::min(int(BATCH), last - begin);
+                for ( int k = 0; k < n; k++ )
+                {
+                    Point r = geo.vdist(a, p[begin + k]);
+                    rx[k] = r.x();
+                    ry[k] = r.y();
+                    rz[k] = r.z();
+                    lim[k] = range(a.id, p[begin + k].id);
+                }
+                int m = 0;
+                for ( int k = 0; k < n; k++ )
+                {
+                    near[m] = k;
+                    m += (rx[k] * rx[k] + ry[k] * ry[k] + rz[k] * rz[k] <= lim[k]);
+                }
+                for ( int l = 0; l < m; l++ )
+                {
+                    int k = near[l];
+                    if ( begin + k != i )
+                        u += operator()(a, p[begin + k], Point(rx[k], ry[k], rz[k]));
+                }
+            }
+            return u;
         }
 
         double operator()( const CigarParticle &a, const CigarParticle &b, double r2 ) const
@@ -976,6 +1096,8 @@ namespace Faunus
 
         double operator()( const CigarParticle &a, const CigarParticle &b, const Point &r_cm )
         {
+            if ( range.far(a.id, b.id, r_cm.squaredNorm()))
+                return 0;
 
             if ( a.halfl < 1e-6 )
             {
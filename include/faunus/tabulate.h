@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <cmath>
 #include <memory>
+#include <array>
 
 #include <faunus/potentials.h>
 
@@ -467,6 +468,192 @@ namespace Faunus
         }
     };
 
+    /**
+     * @brief Floating point type of tabulated pair kernels
+     *
+     * Single precision if compiled with `FAU_SINGLEPRECISION` (cmake option
+     * `ENABLE_SINGLEPRECISION`) which halves the table size and the
+     * memory traffic of lookups. Since every pair passes through the same
+     * table, energy changes and total energies stay consistent and are
+     * summed in double precision by the callers.
+     */
+#ifdef FAU_SINGLEPRECISION
+    typedef float Tkernel;
+#else
+    typedef double Tkernel;
+#endif
+
+    /**
+     * @brief Joint table of several functions with constant time lookup
+     *
+     * The `N` functions are splined with quintic polynomials on common knots
+     * that are placed adaptively, starting from `rmax`, so that all functions
+     * are within the tolerances given by `setTolerance()` (`utol` for values,
+     * `ftol` for first derivatives). Knots are located via a uniform bucket
+     * index, i.e. without the logarithmic search of `Andrea`, and a single
+     * lookup returns all `N` values (and derivatives) at `x`.
+     *
+     * Example:
+     *
+     * ~~~~
+     * Tabulate::Kernel<double,2> k;
+     * k.setRange(0, 1);
+     * k.setTolerance(1e-9, 1e-2);
+     * k.generate({{ [](double x) { return std::exp(-x); }, [](double x) { return x*x; } }});
+     * auto v = k.eval(0.5); // v[0]=exp(-0.5), v[1]=0.25
+     * ~~~~
+     *
+     * `T` is the storage and evaluation type of the table, see `Tkernel`.
+     */
+    template<typename T=double, int N=1>
+    class Kernel : public TabulatorBase<double>
+    {
+    private:
+        typedef TabulatorBase<double> base;
+        int mngrid = 100000;  // Max number of intervals
+        int ndr = 100;        // Max number of trials to decr dr
+        double drfrac = 0.9;  // Multiplicative factor to decr dr
+        T xmin, scale;       // origin and inverse bucket width of index
+        std::vector<T> knot; // lower interval bounds plus upper bound of last interval
+        std::vector<std::array<T, 6 * N>> c; // coefficients for each interval
+        std::vector<int> index; // first interval of each bucket
+
+        /* Quintic coefficients from values and derivatives at both ends (see `Andrea`) */
+        static void coeff( double *c, double dz, double u0, double u1, double u2, double w0, double w1, double w2 )
+        {
+            double dz2 = dz * dz, dz3 = dz2 * dz;
+            double a = 6 * (w0 - u0 - u1 * dz - 0.5 * u2 * dz2) / dz3;
+            double b = 2 * (w1 - u1 - u2 * dz) / dz2;
+            double cc = (w2 - u2) / dz;
+            c[0] = u0;
+            c[1] = u1;
+            c[2] = u2 * 0.5;
+            c[3] = (10 * a - 12 * b + 3 * cc) / 6;
+            c[4] = (-15 * a + 21 * b - 6 * cc) / (6 * dz);
+            c[5] = (2 * a - 3 * b + cc) / (2 * dz2);
+        }
+
+        /* Buckets are normally no wider than the narrowest interval so that one step suffices */
+        size_t find( T x ) const
+        {
+            int b = int((x - xmin) * scale);
+            b = std::max(0, std::min(b, int(index.size()) - 1));
+            size_t i = index[b];
+            i += (x >= knot[i + 1]);
+            while ( i + 1 < c.size() && x >= knot[i + 1] ) // only if the index was capped
+                i++;
+            return std::min(i, c.size() - 1);
+        }
+
+    public:
+        /**
+         * @brief Tabulate functions in [rmin,rmax]
+         *
+         * Knots and coefficients are always determined and checked in
+         * double precision; for `T=float` the stored table adds a relative
+         * rounding error of order `FLT_EPSILON` on top of the tolerances.
+         *
+         * @throw std::runtime_error if the tolerances cannot be met
+         */
+        void generate( std::array<std::function<double( double )>, N> f )
+        {
+            base::check();
+            std::vector<double> xlow;
+            std::vector<std::array<double, 6 * N>> clow;
+            double xupp = base::rmax, dr = base::rmax - base::rmin;
+            while ( xupp > base::rmin )
+            {
+                std::array<double, 6 * N> cbuf;
+                double x0 = xupp;
+                dr = std::min(xupp - base::rmin, 4 * dr);
+                int j;
+                for ( j = 0; j < ndr; j++, dr *= drfrac )
+                {
+                    x0 = std::max(xupp - dr, base::rmin);
+                    bool ok = true;
+                    for ( int k = 0; k < N && ok; k++ )
+                    {
+                        double *ck = cbuf.data() + 6 * k;
+                        coeff(ck, xupp - x0, f[k](x0), base::f1(f[k], x0), base::f2(f[k], x0),
+                              f[k](xupp), base::f1(f[k], xupp), base::f2(f[k], xupp));
+                        for ( int i = 0; i <= 10 && ok; i++ )
+                        {
+                            double dz = (xupp - x0) * i / 10;
+                            double u = ck[0] + dz * (ck[1] + dz * (ck[2] + dz * (ck[3] + dz * (ck[4] + dz * ck[5]))));
+                            double du = ck[1] + dz * (2 * ck[2] + dz * (3 * ck[3] + dz * (4 * ck[4] + dz * 5 * ck[5])));
+                            if ( std::fabs(u - f[k](x0 + dz)) > base::utol )
+                                ok = false;
+                            else if ( base::ftol != -1 && std::fabs(du - base::f1(f[k], x0 + dz)) > base::ftol )
+                                ok = false;
+                        }
+                    }
+                    if ( ok )
+                        break;
+                }
+                if ( j >= ndr || int(xlow.size()) >= mngrid )
+                    throw std::runtime_error("Kernel spline: try to increase utol/ftol");
+                xlow.push_back(x0);
+                clow.push_back(cbuf);
+                dr = xupp - x0;
+                xupp = x0;
+            }
+
+            // sort in ascending order, convert to T and build bucket index
+            knot.assign(xlow.rbegin(), xlow.rend());
+            knot.push_back(base::rmax);
+            c.resize(clow.size());
+            for ( size_t i = 0; i < c.size(); i++ )
+                std::copy(clow[c.size() - 1 - i].begin(), clow[c.size() - 1 - i].end(), c[i].begin());
+            xmin = base::rmin;
+            T width = base::rmax - base::rmin;
+            for ( size_t i = 0; i < c.size(); i++ )
+                width = std::min(width, knot[i + 1] - knot[i]);
+            width = std::max(width, T((base::rmax - base::rmin) / (1 << 20)));
+            index.resize(size_t(std::ceil((base::rmax - base::rmin) / width)) + 1);
+            scale = 1 / width;
+            size_t i = 0;
+            for ( size_t b = 0; b < index.size(); b++ )
+            {
+                while ( i + 1 < c.size() && xmin + b / scale >= knot[i + 1] )
+                    i++;
+                index[b] = i;
+            }
+        }
+
+        bool empty() const { return c.empty(); }
+
+        /** @brief Number of intervals */
+        size_t size() const { return c.size(); }
+
+        /** @brief Values of all functions at `x` */
+        std::array<T, N> eval( T x ) const
+        {
+            size_t i = find(x);
+            T dz = x - knot[i];
+            std::array<T, N> u;
+            for ( int k = 0; k < N; k++ )
+            {
+                const T *ck = c[i].data() + 6 * k;
+                u[k] = ck[0] + dz * (ck[1] + dz * (ck[2] + dz * (ck[3] + dz * (ck[4] + dz * ck[5]))));
+            }
+            return u;
+        }
+
+        /** @brief First derivatives of all functions at `x` */
+        std::array<T, N> evalDer( T x ) const
+        {
+            size_t i = find(x);
+            T dz = x - knot[i];
+            std::array<T, N> du;
+            for ( int k = 0; k < N; k++ )
+            {
+                const T *ck = c[i].data() + 6 * k;
+                du[k] = ck[1] + dz * (2 * ck[2] + dz * (3 * ck[3] + dz * (4 * ck[4] + dz * 5 * ck[5])));
+            }
+            return du;
+        }
+    };
+
     /**
      * @brief Andrea table optimized for intel compiler
      *
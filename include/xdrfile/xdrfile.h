@@ -61,10 +61,9 @@
  *    three decimals guaranteed accuracy, and reduces the filesize to 1/10th
  *    of normal binary data.
  *
- * We do not support getting or setting positions in XDR files, since it can
- * break in horrible ways for large (64-bit) files, resulting in silent data
- * corruption. Note that it works great to open/read/write 64-bit files if
- * your system supports it; it is just the random access we cannot trust!
+ * Getting and setting positions is supported through xdrfile_tell() and
+ * xdrfile_seek() which use 64-bit offsets (fseeko/ftello) so that frame
+ * indices of large trajectories can be used for random access.
  *
  * We also provide wrapper routines so this module can be used from FORTRAN -
  * see the file xdrfile_fortran.txt in the Gromacs distribution for 
@@ -140,6 +139,30 @@ int
 xdrfile_close   (XDRFILE *       xfp);
 
 
+/*! \brief Get current byte position in a portable binary file, just like ftell()
+ *
+ *  \param xfp  Pointer to an abstract XDRFILE datatype
+ *
+ *  \return     Offset in bytes from the beginning of the file, or -1 on error.
+ */
+long long
+xdrfile_tell    (XDRFILE *       xfp);
+
+
+/*! \brief Set byte position in a portable binary file, just like fseek()
+ *
+ *  \param xfp     Pointer to an abstract XDRFILE datatype
+ *  \param offset  Offset in bytes relative to `whence`
+ *  \param whence  SEEK_SET, SEEK_CUR or SEEK_END
+ *
+ *  \return        exdrOK on success, exdrENDOFFILE on error.
+ */
+int
+xdrfile_seek    (XDRFILE *       xfp,
+                 long long       offset,
+                 int             whence);
+
+
 
 
 /*! \brief Read one or more \a char type variable(s) 
@@ -1,5 +1,6 @@
 # DYLD_LIBRARY_PATH="/Users/mikael/miniconda/lib/" python test.py
 
+from __future__ import print_function
 import pyfaunus as mc
 import numpy as np
 
@@ -8,12 +9,45 @@ spc    = mc.Space(mcp)
 geo    = spc.geo
 groups = spc.groupList()
 
-print "number of particles            = ", len(spc.p)
-print "number of groups               = ", len(groups)
-print "system volume                  = ", geo.getVolume()
+print("number of particles            = ", len(spc.p))
+print("number of groups               = ", len(groups))
+print("system volume                  = ", geo.getVolume())
 
 cm = mc.massCenter(spc.geo, spc.p, groups[0])
-print "mass center                    = ", np.array(cm)
-print "distance between two particles = ", geo.dist(spc.p[0], spc.p[1])
+print("mass center                    = ", np.array(cm))
+print("distance between two particles = ", geo.dist(spc.p[0], spc.p[1]))
 
-print "index in 1st group:\n", groups[0].range()
\ No newline at end of file
+print("index in 1st group:\n", groups[0].range())
+
+x = np.asarray(spc.positions())       # zero-copy (N,3) view of spc.p
+q = np.asarray(spc.charges())         # ditto for charges; see also ids()
+print("net charge                     = ", q.sum())
+print("mean position                  = ", x.mean(axis=0))
+
+# views and batched calls must agree with scalar access
+assert x.shape == (len(spc.p), 3)
+assert np.allclose(x[1], [spc.p[1].x, spc.p[1].y, spc.p[1].z])
+assert np.allclose(q, [a.charge for a in spc.p])
+
+mcp = mc.InputMap('pyfaunus-test.json') # salt with coulomb+lj
+spc = mc.Space(mcp)
+pot = mc.Hamiltonian(mcp, spc)
+x   = np.asarray(spc.positions())
+
+index = np.arange(len(spc.p), dtype=np.int32)
+u = pot.i2all(index)
+assert np.allclose(u, [pot.i2all(i) for i in range(len(spc.p))])
+
+spc.sync()
+u = pot.i2all(0, x[:3].copy())        # trial positions of particle 0
+assert np.isclose(u[0], pot.i2all(0))
+assert np.allclose(x[0], [spc.p[0].x, spc.p[0].y, spc.p[0].z])
+
+for bad in (-1, len(spc.p)):
+    for f in (lambda: pot.i2all(bad), lambda: pot.i2all(np.array([bad], dtype=np.int32))):
+        try:
+            f()
+            assert False, "out of range index accepted"
+        except RuntimeError:
+            pass
+print("views and batched calls        =  ok")
@@ -17,6 +17,65 @@ using namespace Faunus;
 typedef Geometry::Cuboid Tgeometry;
 typedef Space<Tgeometry> Tspace;
 typedef typename Tspace::ParticleVector Tpvec;
+typedef typename Tspace::ParticleType Tparticle;
+typedef Energy::Hamiltonian<Tspace> Thamiltonian;
+
+/**
+ * @brief Strided view of a particle property in a particle vector
+ *
+ * Exposed via the buffer protocol so that i.e. `numpy.asarray()` maps
+ * directly onto the particle vector without copying. The view is
+ * re-evaluated each time a buffer is requested, but arrays obtained
+ * from it become invalid if particles are inserted or erased.
+ */
+struct ParticleView
+{
+    Tpvec *p;
+    size_t offset;    // byte offset of property in particle
+    size_t itemsize;  // size of scalar
+    size_t cols;      // number of scalars (3 for positions)
+    std::string format;
+
+    template<class T>
+    static ParticleView make( Tpvec &p, const Tparticle &a, const T *member, size_t cols )
+    {
+        return {&p, size_t((const char *) member - (const char *) &a), sizeof(T),
+                cols, py::format_descriptor<T>::value()};
+    }
+
+    py::buffer_info info() const
+    {
+        char *ptr = p->empty() ? nullptr : (char *) p->data() + offset;
+        if ( cols > 1 )
+            return py::buffer_info(ptr, itemsize, format, 2, {p->size(), cols}, {sizeof(Tparticle), itemsize});
+        return py::buffer_info(ptr, itemsize, format, 1, {p->size()}, {sizeof(Tparticle)});
+    }
+};
+
+/** @brief Two dimensional (N,3) positions from NumPy array */
+static std::vector<Point> toPoints( py::array_t<double> &a )
+{
+    auto info = a.request();
+    if ( info.ndim != 2 || info.shape[1] != 3 )
+        throw std::runtime_error("array of shape (N,3) expected");
+    std::vector<Point> v(info.shape[0]);
+    const double *d = (const double *) info.ptr;
+    for ( size_t i = 0; i < v.size(); i++ )
+        v[i] = Point(d[3 * i], d[3 * i + 1], d[3 * i + 2]);
+    return v;
+}
+
+/** @brief One dimensional index vector from NumPy array with indices in range [0:size[ */
+static std::vector<int> toIndex( py::array_t<int> &a, size_t size )
+{
+    auto info = a.request();
+    const int *d = (const int *) info.ptr;
+    std::vector<int> v(d, d + info.count);
+    for ( auto i : v )
+        if ( i < 0 || size_t(i) >= size )
+            throw std::runtime_error("index out of range");
+    return v;
+}
 
 PYBIND11_PLUGIN(pyfaunus)
 {
@@ -111,6 +170,11 @@ PYBIND11_PLUGIN(pyfaunus)
           "Calculates the dipole moment of a group");
     //py::arg("cutoff")=1e9, py::arg("mu") = Point());
 
+    // Particle property views -- use i.e. `numpy.asarray(spc.positions())`
+    py::class_<ParticleView>(m, "ParticleView")
+        .def("__len__", []( ParticleView &v ) { return v.p->size(); })
+        .def_buffer([]( ParticleView &v ) { return v.info(); });
+
     // Space
     py::class_<Tspace>(m, "Space")
         .def("info", &Tspace::info)
@@ -128,8 +192,93 @@ PYBIND11_PLUGIN(pyfaunus)
         .def_readwrite("p", &Tspace::p, py::return_value_policy::reference_internal)
         .def_readwrite("trial", &Tspace::trial)
         .def_readwrite("geo", &Tspace::geo)
+        .def("positions", []( Tspace &s )
+        {
+            Tparticle a;
+            return ParticleView::make(s.p, a, a.data(), 3);
+        }, "Zero-copy (N,3) view of particle positions")
+        .def("charges", []( Tspace &s )
+        {
+            Tparticle a;
+            return ParticleView::make(s.p, a, &a.charge, 1);
+        }, "Zero-copy view of particle charges")
+        .def("ids", []( Tspace &s )
+        {
+            Tparticle a;
+            return ParticleView::make(s.p, a, &a.id, 1);
+        }, "Zero-copy view of particle ids")
+        .def("sync", []( Tspace &s ) { s.trial = s.p; }, "Copy particles to trial vector")
         .def(py::init<Tmjson &>());
 
+    // Hamiltonian -- batched calls release the GIL and return NumPy arrays
+    py::class_<Thamiltonian>(m, "Hamiltonian")
+        .def(py::init<Tmjson &, Tspace &>())
+        .def("info", &Thamiltonian::info)
+        .def("i2all", []( Thamiltonian &h, int i )
+        {
+            auto &s = h.getSpace();
+            if ( i < 0 || size_t(i) >= s.p.size())
+                throw std::runtime_error("index out of range");
+            return h.i2all(s.p, i);
+        }, "Energy of i'th particle with all other particles")
+        .def("g2g", []( Thamiltonian &h, int i, int j )
+        {
+            auto &s = h.getSpace();
+            return h.g2g(s.p, *s.groupList().at(i), *s.groupList().at(j));
+        }, "Energy between i'th and j'th group in `groupList()`")
+        .def("i2all", []( Thamiltonian &h, py::array_t<int> index )
+        {
+            auto &s = h.getSpace();
+            auto v = toIndex(index, s.p.size());
+            std::vector<double> u(v.size());
+            {
+                py::gil_scoped_release release;
+                for ( size_t k = 0; k < v.size(); k++ )
+                    u[k] = h.i2all(s.p, v[k]);
+            }
+            return py::array(u.size(), u.data());
+        }, "Energy of each indexed particle with all other particles")
+        .def("i2all", []( Thamiltonian &h, int i, py::array_t<double> pos )
+        {
+            auto &s = h.getSpace();
+            if ( i < 0 || size_t(i) >= s.trial.size())
+                throw std::runtime_error("index out of range");
+            auto r = toPoints(pos);
+            auto old = s.trial[i];
+            std::vector<double> u(r.size());
+            {
+                py::gil_scoped_release release;
+                for ( size_t k = 0; k < r.size(); k++ )
+                {
+                    s.trial[i] = r[k];
+                    s.geo.boundary(s.trial[i]);
+                    u[k] = h.i2all(s.trial, i);
+                }
+                s.trial[i] = old;
+            }
+            return py::array(u.size(), u.data());
+        }, "Energy of i'th particle with all other particles for each trial position (call `Space.sync()` first)")
+        .def("g2g", []( Thamiltonian &h, py::array_t<int> first, py::array_t<int> second )
+        {
+            auto &s = h.getSpace();
+            auto a = toIndex(first, s.groupList().size()), b = toIndex(second, s.groupList().size());
+            if ( a.size() != b.size())
+                throw std::runtime_error("index arrays must have equal length");
+            std::vector<Group *> g;
+            for ( size_t k = 0; k < a.size(); k++ )
+            {
+                g.push_back(s.groupList()[a[k]]);
+                g.push_back(s.groupList()[b[k]]);
+            }
+            std::vector<double> u(a.size());
+            {
+                py::gil_scoped_release release;
+                for ( size_t k = 0; k < u.size(); k++ )
+                    u[k] = h.g2g(s.p, *g[2 * k], *g[2 * k + 1]);
+            }
+            return py::array(u.size(), u.data());
+        }, "Energy between pairs of groups given by two index arrays");
+
     //py::class_<Move::Propagator<Tspace>>(m, "Propagator")
     //    .def("info", &Move::Propagator<Tspace>::info);
 
@@ -53,6 +53,24 @@ namespace Faunus
 
     void AnalysisBase::test( UnitTest &t ) { _test(t); }
 
+    bool AnalysisBase::_combine( AnalysisBase &other ) { return false; }
+
+    /**
+     * Used to combine results from independent analyses of the same type,
+     * for example when a trajectory is split over several threads. Only
+     * analyses that implement `_combine()` will carry over their averages;
+     * for all others a warning is issued.
+     */
+    void AnalysisBase::combine( AnalysisBase &other )
+    {
+        if ( other.cnt == 0 )
+            return;
+        if ( _combine(other))
+            cnt += other.cnt;
+        else
+            std::cerr << "# warning: analysis '" << name << "' does not support merging - samples discarded\n";
+    }
+
     string AnalysisBase::info()
     {
         using namespace textio;
@@ -156,6 +174,28 @@ namespace Faunus
         return j;
     }
 
+    bool PairFunctionBase::_combine( AnalysisBase &other )
+    {
+        auto o = dynamic_cast<PairFunctionBase *>(&other);
+        if ( o == nullptr || o->datavec.size() != datavec.size())
+            return false;
+        for ( size_t i = 0; i < datavec.size(); i++ )
+            if ( datavec[i].dr != o->datavec[i].dr || datavec[i].name1 != o->datavec[i].name1
+                || datavec[i].name2 != o->datavec[i].name2 )
+                return false;
+        V = V + o->V;
+        for ( size_t i = 0; i < datavec.size(); i++ )
+        {
+            auto &d = datavec[i];
+            auto &od = o->datavec[i];
+            for ( auto &b : od.hist.getMap())
+                d.hist.getMap()[b.first] += b.second;
+            for ( auto &b : od.hist2.getMap())
+                d.hist2.getMap()[b.first] = d.hist2.getMap()[b.first] + b.second;
+        }
+        return true;
+    }
+
     PairFunctionBase::PairFunctionBase( Tmjson j, string name ) : AnalysisBase(j, name) {
         try {
             for (auto &i : j.at("pairs"))
@@ -241,6 +281,15 @@ namespace Faunus
         return js;
     }
 
+    void CombinedAnalysis::combine( CombinedAnalysis &other )
+    {
+        if ( other.v.size() != v.size())
+            throw std::runtime_error("cannot combine analyses of different composition");
+        cnt += other.cnt;
+        for ( size_t i = 0; i < v.size(); i++ )
+            v[i]->combine(*other.v[i]);
+    }
+
     CombinedAnalysis::~CombinedAnalysis()
     {
         if (cnt>0) {
@@ -0,0 +1,420 @@
+#include <faunus/faunus.h>
+
+/**
+ * @brief Micro benchmarks for performance regression tracking
+ *
+ * Measures throughput of pair potentials, geometries, tabulators and
+ * Space insert/erase operations. Results are written as JSON to
+ * standard output, or to the file given as first argument.
+ * Run via the `benchmarks` target which additionally measures MC
+ * sweep rates of selected examples, see `benchmarks.py`.
+ */
+
+using namespace Faunus;
+
+namespace
+{
+
+  volatile double sink; // prevents results from being optimized away
+
+  /**
+   * @brief Operations per second of `f` which performs `ops` operations per call
+   *
+   * `f` is called repeatedly until at least `mintime` seconds have passed.
+   */
+  template<class Tfunc>
+  double rate( Tfunc f, double ops, double mintime = 0.2 )
+  {
+      typedef std::chrono::steady_clock Tclock;
+      unsigned long n = 0;
+      double t = 0, s = 0;
+      auto t0 = Tclock::now();
+      do
+      {
+          s += f();
+          n++;
+          t = std::chrono::duration<double>(Tclock::now() - t0).count();
+      }
+      while ( t < mintime );
+      sink = s;
+      return n * ops / t;
+  }
+
+  template<class Tparticle>
+  std::vector<Tparticle> randomParticles( Geometry::Geometrybase &geo, size_t N )
+  {
+      std::vector<Tparticle> p(N);
+      for ( size_t i = 0; i < N; i++ )
+      {
+          geo.randompos(p[i]);
+          p[i].id = i % 2;
+          p[i].charge = (i % 2 == 0) ? 1 : -1;
+          p[i].radius = 2;
+      }
+      return p;
+  }
+
+  /** @brief Pair evaluations per second for potentials taking the squared distance */
+  template<class Tpairpot, class Tpvec>
+  double pairRate( Tpairpot &pot, Geometry::Cuboid &geo, const Tpvec &p )
+  {
+      return rate([&]()
+                  {
+                      double u = 0;
+                      for ( size_t i = 0; i < p.size() - 1; i++ )
+                          for ( size_t j = i + 1; j < p.size(); j++ )
+                              u += pot(p[i], p[j], geo.sqdist(p[i], p[j]));
+                      return u;
+                  }, p.size() * (p.size() - 1) / 2);
+  }
+
+  /** @brief Pair evaluations per second for potentials taking the distance vector */
+  template<class Tpairpot, class Tpvec>
+  double pairRateVector( Tpairpot &pot, Geometry::Cuboid &geo, const Tpvec &p )
+  {
+      return rate([&]()
+                  {
+                      double u = 0;
+                      for ( size_t i = 0; i < p.size() - 1; i++ )
+                          for ( size_t j = i + 1; j < p.size(); j++ )
+                              u += pot(p[i], p[j], geo.vdist(p[i], p[j]));
+                      return u;
+                  }, p.size() * (p.size() - 1) / 2);
+  }
+
+  /**
+   * @brief Pair potential throughput
+   * @param N Number of random particles in a 60 angstrom periodic box
+   *
+   * Potentials that need external input files (`Potfromfile`, `NemoRepulsion`),
+   * write to standard output (`YukawaGel`), or need cap particles (`HardSphereCap`)
+   * are not included.
+   */
+  Tmjson pairpotentials( size_t N )
+  {
+      using namespace Potential;
+      Tmjson js;
+      Tmjson geojs = {{"length", 60}};
+      Geometry::Cuboid geo(geojs);
+      auto p = randomParticles<PointParticle>(geo, N);
+      auto pd = randomParticles<DipoleParticle>(geo, N);
+      for ( auto &i : pd )
+      {
+          i.mu() = Point(0, 0, 1);
+          i.muscalar() = 1;
+      }
+
+      Tmjson empty = Tmjson::object();
+      Tmjson lj = {{"eps", 0.1}};
+      Tmjson cos = {{"eps", 0.1}, {"rc", 4.0}, {"wc", 1.0}};
+      Tmjson el = {{"epsr", 80.0}, {"debyelength", 10.0}, {"cutoff", 20.0}};
+      Tmjson sw = {{"threshold", 2.0}, {"threshold_lower", 1.0}, {"depth", 0.5}};
+
+      {
+          HardSphere pot;
+          js["HardSphere"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          LennardJones pot(lj);
+          js["LennardJones"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          LennardJonesLB pot(empty);
+          js["LennardJonesLB"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          WeeksChandlerAndersen pot(empty);
+          js["WeeksChandlerAndersen"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          SoftRepulsion pot(empty);
+          js["SoftRepulsion"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          R12Repulsion pot(lj);
+          js["R12Repulsion"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          CosAttract pot(cos);
+          js["CosAttract"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          LennardJonesR12 pot(lj);
+          js["LennardJonesR12"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          LennardJonesTrunkShift pot(lj);
+          js["LennardJonesTrunkShift"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          Tmjson j = {{"alpha", 0.5}};
+          Cardinaux pot(j);
+          js["Cardinaux"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          SquareWell pot(sw);
+          js["SquareWell"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          SquareWellShifted pot(sw);
+          js["SquareWellShifted"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          SquareWellHydrophobic pot(sw);
+          js["SquareWellHydrophobic"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          Tmjson j = {{"k", 0.1}, {"req", 5.0}};
+          Harmonic pot(j);
+          js["Harmonic"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          Tmjson j = {{"stiffness", 0.1}, {"maxsep", 100.0}};
+          FENE pot(j);
+          js["FENE"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          Tmjson j = {{"_E", 1.0}};
+          Hertz pot(j);
+          js["Hertz"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          Coulomb pot(el);
+          js["Coulomb"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          DebyeHuckel pot(el);
+          js["DebyeHuckel"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          DebyeHuckelShift pot(el);
+          js["DebyeHuckelShift"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          DebyeHuckelSD pot(el);
+          js["DebyeHuckelSD"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          DebyeHuckelDenton pot(el);
+          js["DebyeHuckelDenton"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          CoulombWolf pot(el);
+          js["CoulombWolf"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          ChargeNonpolar pot(el);
+          js["ChargeNonpolar"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+      {
+          PolarPolar pot(el);
+          js["PolarPolar"]["pairs/s"] = pairRate(pot, geo, p);
+      }
+
+      for ( string type : {"plain", "wolf", "fennel", "yonezawa", "fanourgakis", "qpotential", "reactionfield", "yukawa"} )
+      {
+          Tmjson j = el;
+          j["coulombtype"] = type;
+          j["alpha"] = 0.1;
+          j["eps_rf"] = 80.0;
+          j["order"] = 3;
+          CoulombGalore pot(j);
+          js["CoulombGalore-" + type]["pairs/s"] = pairRate(pot, geo, p);
+      }
+
+      for ( string type : {"plain", "wolf", "fanourgakis", "reactionfield"} )
+      {
+          Tmjson j = el;
+          j["coulombtype"] = type;
+          j["alpha"] = 0.1;
+          j["eps_rf"] = 80.0;
+          j["order"] = 3;
+          DipoleDipoleGalore pot(j);
+          js["DipoleDipoleGalore-" + type]["pairs/s"] = pairRateVector(pot, geo, pd);
+      }
+
+      {
+          IonDipole pot(el);
+          js["IonDipole"]["pairs/s"] = pairRateVector(pot, geo, pd);
+      }
+      {
+          IonQuad pot(el);
+          js["IonQuad"]["pairs/s"] = pairRateVector(pot, geo, pd);
+      }
+      {
+          Tmjson j = el;
+          j["kappa"] = 0.1;
+          j["forceshifted"] = true;
+          MultipoleWolf<true, true, true, true> pot(j);
+          js["MultipoleWolf"]["pairs/s"] = pairRateVector(pot, geo, pd);
+      }
+      return js;
+  }
+
+  template<class Tgeometry>
+  Tmjson geometry( Tgeometry &geo, size_t N = 1000 )
+  {
+      auto p = randomParticles<PointParticle>(geo, N);
+      Tmjson j;
+      j["sqdist/s"] = rate([&]()
+                           {
+                               double s = 0;
+                               for ( size_t i = 1; i < N; i++ )
+                                   s += geo.sqdist(p[i], p[i - 1]);
+                               return s;
+                           }, N - 1);
+      j["vdist/s"] = rate([&]()
+                          {
+                              double s = 0;
+                              for ( size_t i = 1; i < N; i++ )
+                                  s += geo.vdist(p[i], p[i - 1]).sum();
+                              return s;
+                          }, N - 1);
+      j["boundary/s"] = rate([&]()
+                             {
+                                 double s = 0;
+                                 for ( size_t i = 1; i < N; i++ )
+                                 {
+                                     Point a = p[i] + p[i - 1];
+                                     geo.boundary(a);
+                                     s += a.sum();
+                                 }
+                                 return s;
+                             }, N - 1);
+      return j;
+  }
+
+  Tmjson geometries()
+  {
+      Tmjson js;
+      Tmjson cub = {{"length", 50}}, sph = {{"radius", 50}}, cyl = {{"length", 100}, {"radius", 30}};
+      Geometry::Cuboid cuboid(cub);
+      Geometry::Cube cube(cub);
+      Geometry::Cuboidslit slit(cub);
+      Geometry::Sphere sphere(sph);
+      Geometry::Cylinder cylinder(cyl);
+      Geometry::PeriodicCylinder pcylinder(cyl);
+      js["Cuboid"] = geometry(cuboid);
+      js["Cube"] = geometry(cube);
+      js["Cuboidslit"] = geometry(slit);
+      js["Sphere"] = geometry(sphere);
+      js["Cylinder"] = geometry(cylinder);
+      js["PeriodicCylinder"] = geometry(pcylinder);
+      return js;
+  }
+
+  template<class Ttabulator>
+  Tmjson tabulator()
+  {
+      Ttabulator tab;
+      tab.setRange(1, 30);
+      tab.setTolerance(1e-6, 1e-4);
+      auto d = tab.generate([]( double r2 ) { return std::exp(-std::sqrt(r2) / 10) / std::sqrt(r2); });
+      size_t N = 1000;
+      std::vector<double> r2(N);
+      for ( auto &i : r2 )
+          i = 1 + slump() * (30 * 30 - 1);
+      return {{"eval/s", rate([&]()
+                              {
+                                  double s = 0;
+                                  for ( auto i : r2 )
+                                      s += tab.eval(d, i);
+                                  return s;
+                              }, N)},
+              {"knots", d.r2.size()}};
+  }
+
+  Tmjson tabulators()
+  {
+      Tmjson js;
+      js["Andrea"] = tabulator<Tabulate::Andrea<double>>();
+      js["AndreaIntel"] = tabulator<Tabulate::AndreaIntel<double>>();
+      js["Hermite"] = tabulator<Tabulate::Hermite<double>>();
+      js["Linear"] = tabulator<Tabulate::Linear<double>>();
+      return js;
+  }
+
+  /** @brief Space insert/erase/eraseGroup rates for a system of salt and dimers */
+  Tmjson space( Tmjson &in )
+  {
+      typedef Space<Geometry::Cuboid> Tspace;
+      Tspace spc(in);
+      auto &salt = *spc.molList().find("salt");
+      auto &dimer = *spc.molList().find("dimer");
+      Tspace::ParticleVector v(2);  // dimer conformation
+      v[0] = atom["A"];
+      v[1] = atom["B"];
+      v[1].z() = 4;
+      dimer.pushConformation(v);
+      int n = 200;
+      typedef std::chrono::steady_clock Tclock;
+      std::chrono::duration<double> tins(0), terase(0), tinsg(0), teraseg(0);
+
+      for ( int i = 0; i < n; i++ )
+      {
+          v = salt.getRandomConformation(spc.geo, spc.p);
+          auto t0 = Tclock::now();
+          auto g = spc.insert(salt.id, v);
+          auto t1 = Tclock::now();
+          int ndx = g->back();
+          spc.erase(ndx);
+          spc.erase(ndx - 1);
+          auto t2 = Tclock::now();
+          tins += t1 - t0;
+          terase += t2 - t1;
+
+          v = dimer.getRandomConformation(spc.geo, spc.p);
+          t0 = Tclock::now();
+          spc.insert(dimer.id, v);
+          t1 = Tclock::now();
+          spc.eraseGroup(spc.groupList().size() - 1);
+          t2 = Tclock::now();
+          tinsg += t1 - t0;
+          teraseg += t2 - t1;
+      }
+      return {{"particles", spc.p.size()},
+              {"groups", spc.groupList().size()},
+              {"insert atomic/s", n / tins.count()},
+              {"erase/s", 2 * n / terase.count()},
+              {"insert molecule/s", n / tinsg.count()},
+              {"eraseGroup/s", n / teraseg.count()}};
+  }
+
+}//namespace
+
+int main( int argc, char **argv )
+{
+    Tmjson in = {
+        {"atomlist", {
+            {"A", {{"q", 1.0}, {"sigma", 4.0}, {"eps", 0.1}, {"dp", 1.0}}},
+            {"B", {{"q", -1.0}, {"sigma", 4.0}, {"eps", 0.1}, {"dp", 1.0}}}}},
+        {"moleculelist", {
+            {"salt", {{"atoms", "A B"}, {"atomic", true}, {"Ninit", 500}}},
+            {"dimer", {{"atoms", "A B"}}}}},
+        {"system", {{"geometry", {{"length", 100}}}}}
+    };
+
+    Tmjson out;
+    size_t npairpot = 500;
+    out["info"]["pair potentials"] = "pairs/s for " + std::to_string(npairpot) + " random particles in a 60 A periodic box";
+#ifdef GIT_COMMIT_HASH
+    out["info"]["git revision"] = GIT_COMMIT_HASH;
+#endif
+#ifdef NDEBUG
+    out["info"]["assertions"] = false;
+#else
+    out["info"]["assertions"] = true;
+#endif
+    out["space"] = space(in); // also loads atom types
+    out["pair potentials"] = pairpotentials(npairpot);
+    out["geometries"] = geometries();
+    out["tabulators"] = tabulators();
+
+    if ( argc > 1 )
+    {
+        std::ofstream f(argv[1]);
+        f << std::setw(4) << out << endl;
+    }
+    else
+        cout << std::setw(4) << out << endl;
+}
@@ -0,0 +1,98 @@
+#!/usr/bin/env python
+"""
+Run micro benchmarks and measure MC sweep rates of selected examples.
+
+Results are collected in a single JSON file suitable for regression
+tracking, i.e. by comparing against a file from a previous revision:
+
+    python benchmarks.py ... --compare old.json
+
+where relative changes larger than `--tolerance` are reported.
+Sweep rates are trial moves per second spent in the moves, as reported
+by `move_out.json`, so that setup and analysis do not enter. Examples
+that fail are reported and make the script return non-zero.
+"""
+from __future__ import print_function
+import json, sys, os, time, argparse
+from subprocess import call
+
+parser = argparse.ArgumentParser(description='Faunus benchmarks')
+parser.add_argument('--benchmark', default='./benchmark', help='micro benchmark executable')
+parser.add_argument('--examples', default='../examples', help='directory with compiled examples')
+parser.add_argument('--sources', default=os.path.join(os.path.dirname(__file__), '../examples'),
+        help='directory with example python scripts')
+parser.add_argument('--output', default='benchmarks.json', help='output json file')
+parser.add_argument('--compare', default=None, help='compare with previous output')
+parser.add_argument('--tolerance', type=float, default=0.1, help='relative change to report')
+parser.add_argument('--skip-examples', action='store_true', help='run only micro benchmarks')
+args = parser.parse_args()
+
+examples = ['bulk', 'polymers', 'grand', 'stockmayer']
+
+def trials(movefile):
+    """ total number of trial moves and time spent in them from a move_out.json file """
+    with open(movefile) as f:
+        moves = json.load(f)['moves']
+    moves = [ m for m in moves.values() if isinstance(m, dict) and 'trials' in m ]
+    return sum( m['trials'] for m in moves ), sum( m.get('time (s)', 0) for m in moves )
+
+# micro benchmarks
+out = {}
+tmp = os.path.abspath('micro.json')
+if call( [args.benchmark, tmp] ) != 0:
+    sys.exit(1)
+with open(tmp) as f:
+    out = json.load(f)
+
+# full MC simulations
+failed = []
+if not args.skip_examples:
+    out['examples'] = {}
+    cwd = os.getcwd()
+    os.chdir( args.examples )
+    for ex in examples:
+        movefile = 'move_out.json'
+        if os.path.exists(movefile):
+            os.remove(movefile)
+        t0 = time.time()
+        returncode = call( ['python', os.path.join(args.sources, ex+'.py')] )
+        t = time.time() - t0
+        d = { 'wall time (s)': t, 'returncode': returncode }
+        if returncode != 0:
+            print(ex, 'failed with return code', returncode)
+            failed.append(ex)
+        elif os.path.exists(movefile):
+            n, tmove = trials(movefile) # time spent in moves, i.e. without setup and analysis
+            d['trials'] = n
+            d['move time (s)'] = tmove
+            if tmove > 0:
+                d['trials/s'] = n / tmove
+        out['examples'][ex] = d
+        print(ex, d)
+    os.chdir(cwd)
+
+with open(args.output, 'w') as f:
+    f.write( json.dumps(out, indent=4, sort_keys=True) )
+
+# compare with previous run
+def flatten(d, prefix=''):
+    for k, v in d.items():
+        key = prefix + '/' + k
+        if isinstance(v, dict):
+            for i in flatten(v, key):
+                yield i
+        elif isinstance(v, (int, float)) and not isinstance(v, bool) and k.endswith('/s'):
+            yield key, v
+
+rc = 1 if failed else 0
+if args.compare:
+    with open(args.compare) as f:
+        old = dict( flatten(json.load(f)) )
+    for key, new in flatten(out):
+        if key in old and old[key] > 0:
+            change = (new - old[key]) / old[key]
+            if abs(change) > args.tolerance:
+                print('{:<70} {:+.1%}'.format(key, change))
+                if change < 0:
+                    rc = 1
+sys.exit(rc)
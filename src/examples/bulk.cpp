@@ -15,7 +15,7 @@ typedef CombinedPairPotential<CoulombWolf,LennardJonesLB> Tpairpot; // pair pote
 typedef CutShift<Tpairpot,false> TpairpotCut;
 #endif
 
-typedef Geometry::Cuboid Tgeometry;   // geometry: cube w. periodic boundaries
+typedef Geometry::Cube Tgeometry;     // geometry: cube w. periodic boundaries
 typedef Space<Tgeometry,PointParticle> Tspace;
 
 int main() {
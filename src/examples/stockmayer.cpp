@@ -27,7 +27,7 @@ int main()
 
     spc.load("state");
 
-#ifdef __POLARIZE
+#ifdef POLARIZE
     Move::Propagator<Tspace,true> mv(in,pot,spc);
 #else
     Move::Propagator<Tspace, false> mv(in, pot, spc);
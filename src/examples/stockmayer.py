@@ -66,6 +66,8 @@ with open('stockmayer.json', 'w+') as f:
     f.write(json.dumps(d, indent=4))
 
 exe='./stockmayer'
+if len(sys.argv) > 1:
+  exe=sys.argv[1] # alternative build, e.g. single precision
 rc=1
 if ( os.access( exe, os.X_OK )):
   rc = call( [exe] )
@@ -31,12 +31,46 @@ void checkTabulator(Ttabulator t) {
   }
 }
 
+/* check joint kernel table values and derivatives */
+template<typename T>
+void checkKernel() {
+  double tol=0.01;
+  Tabulate::Kernel<T,2> k;
+  k.setRange(0.9, 100);
+  k.setTolerance(tol,tol);
+  k.generate( {{ [](double x) { return 1/x; }, [](double x) { return std::exp(-x/10); } }} );
+  for (double x=1.0; x<100; x+=1) {
+    auto u = k.eval(x);
+    auto du = k.evalDer(x);
+    CHECK( fabs( u[0] - 1/x ) < tol );
+    CHECK( fabs( u[1] - std::exp(-x/10) ) < tol );
+    CHECK( fabs( du[0] + 1/(x*x) ) < tol );
+    CHECK( fabs( du[1] + std::exp(-x/10)/10 ) < tol );
+  }
+}
+
+/* check that CoulombGalore forces equal -dU/dr */
+void checkCoulombForce(Tmjson js) {
+  Potential::CoulombGalore pot( js );
+  PointParticle a,b;
+  a.charge=1;
+  b.charge=-1;
+  double h=1e-4;
+  for (double r=2; r<js["cutoff"].get<double>()-h; r+=0.5) {
+    double f = -( pot(a,b,(r+h)*(r+h)) - pot(a,b,(r-h)*(r-h)) ) / (2*h);
+    Point F = pot.force(a,b,r*r,Point(r,0,0));
+    CHECK( F.x() == Approx(f).epsilon(1e-4) );
+    CHECK( fabs(F.y()) < 1e-12 );
+  }
+}
+
 TEST_CASE("Spline table", "Spline")
 {
   checkTabulator(Tabulate::Hermite<double>());
   checkTabulator(Tabulate::AndreaIntel<double>());
   checkTabulator(Tabulate::Andrea<double>());
   checkTabulator(Tabulate::Linear<double>());
+  checkKernel<double>();
 
   PointParticle a,b;
   a.charge=1;
@@ -57,6 +91,15 @@ TEST_CASE("Spline table", "Spline")
   // Check if negative potential operator works
   auto minus = Potential::Coulomb( js ) - Potential::Coulomb( js );
   CHECK( abs(minus(a,b,7)) < 1e-6 );
+
+  // Check splined Coulomb forces against the energy
+  Tmjson jc = { {"cutoff",12.0}, {"epsr",80.0}, {"tab_ftol",1e-6} };
+  for (string type : {"plain","qpotential","wolf","fennel","yukawa"}) {
+    jc["coulombtype"] = type;
+    jc["alpha"] = 0.2;
+    jc["debyelength"] = 10.0;
+    checkCoulombForce(jc);
+  }
 }
 
 /*
@@ -192,6 +235,574 @@ TEST_CASE("Ewald Test","Ion-Ion- and Dipole-Dipole-interaction")
   CHECK(Energy::systemEnergy(spc,pot,spc.p) == Approx(-2.0003749*lB));  // Total dipole-dipole interaction energy
 }
 
+TEST_CASE("Multiple-trial Ewald", "Multiple-trial moves with cached reciprocal space")
+{
+  typedef Space<Geometry::Cuboid,DipoleParticle> Tspace;
+  typedef Energy::NonbondedEwald<Tspace,Potential::HardSphere,true,false,false> Tenergy;
+  Tmjson j = {
+    {"system", { {"temperature", 298.0}, {"geometry", { {"length", 20.0} }} }},
+    {"atomlist", {
+      {"mtmNa", { {"q", 1.0}, {"r", 1.5}, {"dp", 4.0} }},
+      {"mtmCl", { {"q",-1.0}, {"r", 1.5}, {"dp", 4.0} }} }},
+    {"moleculelist", {
+      {"mtmsalt", { {"atoms", "mtmNa mtmCl"}, {"atomic", true}, {"Ninit", 10}, {"bulkinsert", "lattice"} }} }},
+    {"energy", { {"nonbonded", {
+      {"ewald", { {"epsr", 10.0}, {"eps_surf", 1.0}, {"cutoff", 9.0}, {"alpha", 0.3},
+                  {"cutoffK", 6}, {"spherical_sum", true}, {"update_frequency", 1000} }} }} }},
+    {"moves", { {"atomtranslate", { {"mtmsalt", { {"peratom", true}, {"ntrials", 4} }} }} }}
+  };
+  Tspace spc(j);
+  Tenergy pot(j);
+  Move::AtomicTranslation<Tspace> mv(pot, spc, j["moves"]["atomtranslate"]);
+
+  double u0 = Energy::systemEnergy(spc, pot, spc.p);
+  double du = 0;
+  for (int i=0; i<20; i++)
+    du += mv.move();
+  CHECK( mv.getAcceptance() > 0 );
+
+  Tenergy ref(j); // full recomputation of the reciprocal space
+  ref.setSpace(spc);
+  double u1 = Energy::systemEnergy(spc, ref, spc.p);
+  CHECK( u1 == Approx(Energy::systemEnergy(spc, pot, spc.p)) );
+  CHECK( u1 - u0 == Approx(du) );
+}
+
+/*
+ * Exposes the cell list search of cluster moves and checks that
+ * it finds all mobile particles found by a brute force search.
+ * Pass `all=true` for moves where all mobile particles are candidates.
+ */
+template<class Tmove>
+struct ClusterProbe : public Tmove
+{
+  template<class... Args>
+  ClusterProbe(Args&&... args) : Tmove(args...) {}
+
+  void check(bool all=false) {
+    auto &spc = *this->spc;
+    for (auto g : spc.molecules(this->mollist.begin()->first)) {
+      this->igroup = g;
+      vector<int> index;
+      this->mark.assign(spc.p.size(), 0);
+      this->nearby(spc.p, index);
+      for (auto i : index)
+        this->mark[i] = 0;
+      std::set<int> found(index.begin(), index.end());
+      CHECK( found.size() == index.size() );
+      for (auto i : *this->gmobile) {
+        bool near = all;
+        for (auto k : *g) {
+          double r = this->threshold + spc.p[i].radius + spc.p[k].radius;
+          if ( spc.geo.sqdist(spc.p[i], spc.p[k]) < r*r )
+            near = true;
+        }
+        if ( near )
+          CHECK( found.count(i) == 1 );
+      }
+    }
+  }
+};
+
+TEST_CASE("Cluster cell list", "Cell list search of cluster moves against brute force")
+{
+  typedef Space<Geometry::Cuboid,DipoleParticle> Tspace;
+  Tmjson j = {
+    {"system", { {"temperature", 298.0}, {"geometry", { {"length", {30.0, 24.0, 20.0}} }} }},
+    {"atomlist", {
+      {"MM", { {"r", 2.0} }},
+      {"clS", { {"r", 1.0}, {"dp", 3.0} }} }},
+    {"moleculelist", {
+      {"clbig", { {"structure", "unittests.aam"}, {"Ninit", 2}, {"bulkinsert", "rsa"} }},
+      {"clsalt", { {"atoms", "clS"}, {"atomic", true}, {"Ninit", 150}, {"bulkinsert", "rsa"} }} }},
+    {"energy", { {"nonbonded", { {"epsr", 80.0} }} }},
+    {"moves", {
+      {"cluster", { {"clbig", { {"clustergroup", "clsalt"}, {"threshold", 2.0}, {"dp", 1.0}, {"dprot", 0.1} }} }},
+      {"atomtranslate", { {"clsalt", { {"peratom", true} }} }} }}
+  };
+  Tspace spc(j);
+  Energy::Nonbonded<Tspace,Potential::HardSphere> pot(j);
+  ClusterProbe<Move::TranslateRotateCluster<Tspace>> mv(pot, spc, j["moves"]["cluster"]);
+  ClusterProbe<Move::TranslateRotateGroupCluster<Tspace>> gmv(j["moves"]["cluster"], pot, spc);
+  Move::AtomicTranslation<Tspace> smv(pot, spc, j["moves"]["atomtranslate"]);
+
+  mv.check();
+  for (int i=0; i<50; i++) {
+    mv.move();   // cell list updated from accepted cluster moves only
+    mv.check();
+    if (i%10==0)
+      smv.move(); // other moves force a comparison of all positions
+    mv.check();
+  }
+  CHECK( mv.getAcceptance() > 0 );
+  CHECK( Energy::systemEnergy(spc, pot, spc.p) == Approx(0) ); // no overlap
+
+  gmv.check(true); // infinite cluster range visits all mobile particles
+
+  // cells overlapping with infinite and half box spheres
+  Geometry::CellList cells(2.0);
+  cells.reset(Point(30,24,20));
+  for (int i=0; i<(int)spc.p.size(); i++)
+    cells.insert(i, spc.p[i]);
+  std::vector<int> index;
+  for (double r : {0.5*30, 1e3, pc::infty}) {
+    index.clear();
+    cells.forNeighbours(spc.p[0], r, [&](int i) { index.push_back(i); });
+    CHECK( index.size() == spc.p.size() );
+  }
+}
+
+TEST_CASE("Volume scaling", "Analytic volume move energy against full evaluation")
+{
+  typedef Space<Geometry::Cuboid,DipoleParticle> Tspace;
+  Tmjson j = {
+    {"system", { {"temperature", 298.0}, {"geometry", { {"length", 40.0} }} }},
+    {"atomlist", {
+      {"MM", { {"r", 2.0} }},
+      {"vsNa", { {"q", 1.0}, {"r", 1.5}, {"dp", 2.0} }},
+      {"vsCl", { {"q",-1.0}, {"r", 2.0}, {"dp", 2.0} }} }},
+    {"moleculelist", {
+      {"vsbig", { {"structure", "unittests.aam"}, {"Ninit", 3}, {"bulkinsert", "rsa"} }},
+      {"vssalt", { {"atoms", "vsNa vsCl"}, {"atomic", true}, {"Ninit", 20}, {"bulkinsert", "rsa"} }} }},
+    {"energy", { {"nonbonded", { {"epsr", 80.0}, {"eps", 0.1} }} }},
+    {"moves", {
+      {"isobaric", { {"dp", 0.5}, {"pressure", 20.0}, {"scalecheck", 0} }},
+      {"moltransrot", { {"vsbig", { {"dp", 2.0}, {"dprot", 0.5} }} }},
+      {"atomtranslate", { {"vssalt", { {"peratom", true} }} }} }}
+  };
+  Tspace spc(j);
+  auto pot = Energy::NonbondedScaling<Tspace,
+       Potential::CombinedPairPotential<Potential::Coulomb,Potential::LennardJones>>(j)
+       + Energy::ExternalPressure<Tspace>(j);
+  Move::Isobaric<Tspace> iso(pot, spc, j["moves"]["isobaric"]);
+  Move::TranslateRotate<Tspace> tr(pot, spc, j["moves"]["moltransrot"]);
+  Move::AtomicTranslation<Tspace> at(pot, spc, j["moves"]["atomtranslate"]);
+  CHECK( iso.info().find("Analytic energy scaling       yes") != string::npos );
+
+  double u = Energy::systemEnergy(spc, pot, spc.p);
+  for (int i=0; i<100; i++) {
+    u += iso.move();
+    CHECK( u == Approx(Energy::systemEnergy(spc, pot, spc.p)) );
+    u += (i%2==0) ? tr.move() : at.move();
+    CHECK( u == Approx(Energy::systemEnergy(spc, pot, spc.p)) );
+  }
+  CHECK( iso.getAcceptance() > 0 );
+  CHECK( tr.getAcceptance() > 0 );
+}
+
+TEST_CASE("Force-biased translation", "Force-biased atomic moves against plain atomic translation")
+{
+  typedef Space<Geometry::Cuboid,DipoleParticle> Tspace;
+  typedef Potential::CombinedPairPotential<Potential::Coulomb,Potential::LennardJones> Tpairpot;
+  Tmjson j = {
+    {"system", { {"temperature", 298.0}, {"geometry", { {"length", 12.0} }} }},
+    {"atomlist", {
+      {"fbP", { {"q", 1.0}, {"r", 1.0}, {"dp", 0.0} }},
+      {"fbM", { {"q",-1.0}, {"r", 1.0}, {"dp", 1.5} }} }},
+    {"moleculelist", {
+      {"fbfix", { {"atoms", "fbP"}, {"atomic", true}, {"Ninit", 1} }},
+      {"fbmob", { {"atoms", "fbM"}, {"atomic", true}, {"Ninit", 1} }} }},
+    {"energy", { {"nonbonded", { {"epsr", 20.0}, {"eps", 0.5} }} }}
+  };
+  Tspace spc(j);
+  auto pot = Energy::Nonbonded<Tspace,Tpairpot>(j);
+  auto mean = [&](Move::AtomicTranslation<Tspace> &mv) {
+    Average<double> r;
+    double u = Energy::systemEnergy(spc, pot, spc.p);
+    for (int i=0; i<200000; i++) {
+      u += mv.move();
+      r += spc.geo.dist(spc.p[0], spc.p[1]);
+    }
+    CHECK( u == Approx(Energy::systemEnergy(spc, pot, spc.p)) );
+    return r.avg();
+  };
+
+  // a non-unit direction must enter the proposal bias
+  Tmjson m = { {"fbmob", { {"dir", "0.3 0.3 0.3"} }} };
+  Move::AtomicTranslation<Tspace> at(pot, spc, m);
+  Move::ForceBiasedTranslation<Tspace> fb(pot, spc, m);
+  CHECK( mean(fb) == Approx(mean(at)).epsilon(0.02) );
+  CHECK( fb.getAcceptance() > 0 );
+
+  // directions with a zero component leave that coordinate untouched
+  double z = spc.p[1].z();
+  Tmjson mxy = { {"fbmob", { {"dir", "1 1 0"} }} };
+  Move::ForceBiasedTranslation<Tspace> fbxy(pot, spc, mxy);
+  for (int i=0; i<100; i++)
+    fbxy.move();
+  CHECK( spc.p[1].z() == Approx(z) );
+
+  Tmjson multi = { {"fbmob", { {"ntrials", 2} }} };
+  CHECK_THROWS( (Move::ForceBiasedTranslation<Tspace>(pot, spc, multi)) );
+}
+
+TEST_CASE("Reptation local energy", "Local internal energy of reptation against full evaluation")
+{
+  typedef Space<Geometry::Cuboid,DipoleParticle> Tspace;
+  Tmjson j = {
+    {"system", { {"temperature", 298.0}, {"geometry", { {"length", 40.0} }} }},
+    {"atomlist", { {"MM", { {"r", 2.0} }} }},
+    {"moleculelist", {
+      {"rpoly", { {"structure", "unittests.aam"}, {"Ninit", 6}, {"bulkinsert", "rsa"},
+        {"bonds", {
+          {"0 1", { {"type", "harmonic"}, {"k", 0.5}, {"req", 5.0} }},
+          {"1 2", { {"type", "harmonic"}, {"k", 0.5}, {"req", 5.0} }},
+          {"2 3", { {"type", "harmonic"}, {"k", 0.5}, {"req", 5.0} }} }} }} }},
+    {"energy", { {"nonbonded", { {"epsr", 80.0}, {"eps", 0.5} }} }},
+    {"moves", { {"reptate", { {"rpoly", { {"bondlength", -1}, {"localcheck", 0} }} }} }}
+  };
+  Tspace spc(j);
+  {
+    auto pot = Energy::Nonbonded<Tspace,
+         Potential::CombinedPairPotential<Potential::Coulomb,Potential::LennardJones>>(j)
+         + Energy::Bonded<Tspace>();
+    Move::Reptation<Tspace> mv(pot, spc, j["moves"]["reptate"]);
+
+    double u = Energy::systemEnergy(spc, pot, spc.p);
+    for (int i=0; i<100; i++) {
+      u += mv.move();
+      CHECK( u == Approx(Energy::systemEnergy(spc, pot, spc.p)) );
+    }
+    CHECK( mv.getAcceptance() > 0 );
+
+    // duplicate indices are counted once
+    auto g = spc.groupList().front();
+    int a = g->front(), b = g->front() + 1;
+    CHECK( pot.g_internal_subset(spc.p, *g, {a, a}) == Approx(pot.g_internal_subset(spc.p, *g, {a})) );
+    CHECK( pot.g_internal_subset(spc.p, *g, {a, b, a, b}) == Approx(pot.g_internal_subset(spc.p, *g, {b, a})) );
+  }
+  std::remove("bondlist.tcl"); // written by `Energy::Bonded` upon destruction
+}
+
+TEST_CASE("Rosenbluth growth", "Rosenbluth factors and configurational-bias regrowth")
+{
+  typedef Space<Geometry::Cuboid,DipoleParticle> Tspace;
+  Tmjson j = {
+    {"system", { {"temperature", 298.0}, {"geometry", { {"length", 20.0} }} }},
+    {"atomlist", {
+      {"MM", { {"r", 2.0} }},
+      {"rgX", { {"r", 3.0} }} }},
+    {"moleculelist", {
+      {"rgobst", { {"atoms", "rgX"}, {"atomic", true}, {"Ninit", 1} }},
+      {"rgpoly", { {"structure", "unittests.aam"}, {"Ninit", 0},
+        {"bonds", {
+          {"0 1", { {"k", 100.0}, {"req", 5.0} }},
+          {"1 2", { {"k", 100.0}, {"req", 5.0} }},
+          {"2 3", { {"k", 100.0}, {"req", 5.0} }} }} }},
+      {"rgfene", { {"structure", "unittests.aam"}, {"Ninit", 0},
+        {"bonds", {
+          {"0 1", { {"type", "fene"}, {"k", 1.0}, {"req", 9.0} }},
+          {"1 2", { {"type", "fene"}, {"k", 1.0}, {"req", 9.0} }},
+          {"2 3", { {"type", "fene"}, {"k", 1.0}, {"req", 9.0} }} }} }} }},
+    {"energy", { {"nonbonded", Tmjson::object()} }}
+  };
+  Tspace spc(j);
+  auto pot = Energy::Nonbonded<Tspace,Potential::HardSphere>(j);
+  pot.setSpace(spc);
+  Move::RosenbluthGrowth<Tspace> cbmc(spc, pot);
+  int poly = spc.molecule["rgpoly"].id, fene = spc.molecule["rgfene"].id;
+  CHECK( cbmc.growable(poly) );
+  CHECK( !cbmc.growable(fene) );
+  CHECK( cbmc.reason(fene).find("harmonic") != string::npos );
+
+  // the average Rosenbluth factor is the fraction of ideal chains without overlap
+  auto overlap = [&](const Tspace::ParticleType &a, const Tspace::ParticleType &b) {
+    return spc.geo.sqdist(a, b) < pow(a.radius + b.radius, 2);
+  };
+  Average<double> W, Pfree;
+  for (int n=0; n<40000; n++) {
+    auto v = spc.molecule[poly].getRandomConformation();
+    W += std::exp(cbmc.grow(v, poly, {}, 0, n%2, 4, false));
+    bool free = true;
+    for (size_t i=0; i<v.size(); i++) {
+      if (i==0)
+        spc.geo.randompos(v[i]);
+      else {
+        Point u;
+        u.ranunit(slump);
+        v[i] = Point(v[i-1] + 5.0*u);
+        spc.geo.boundary(v[i]);
+      }
+      free = free && !overlap(v[i], spc.p[0]);
+      for (size_t l=0; l+1<i; l++)
+        free = free && !overlap(v[i], v[l]);
+    }
+    Pfree += free;
+  }
+  CHECK( W.avg() == Approx(Pfree.avg()).epsilon(0.03) );
+  CHECK( Pfree.avg() < 0.9 );
+
+  // regrowth of chains in the system, i.e. excluding the chain itself
+  j["moleculelist"]["rgpoly"]["Ninit"] = 3;
+  for (auto &b : j["moleculelist"]["rgpoly"]["bonds"])
+    b["k"] = 0.5; // starting structure must be within reach of the bond length distribution
+  j["energy"]["nonbonded"] = { {"epsr", 80.0}, {"eps", 0.5} };
+  j["moves"] = { {"regrow", { {"rgpoly", { {"ktrial", 4} }} }},
+                 {"regrowfene", { {"rgfene", { {"ktrial", 4} }} }} };
+  Tspace spc2(j);
+  {
+    auto pot2 = Energy::Nonbonded<Tspace,
+         Potential::CombinedPairPotential<Potential::Coulomb,Potential::LennardJones>>(j)
+         + Energy::Bonded<Tspace>();
+    Move::Regrowth<Tspace> mv(pot2, spc2, j["moves"]["regrow"]);
+    double u = Energy::systemEnergy(spc2, pot2, spc2.p);
+    for (int i=0; i<200; i++) {
+      u += mv.move();
+      CHECK( u == Approx(Energy::systemEnergy(spc2, pot2, spc2.p)) );
+    }
+    CHECK( mv.getAcceptance() > 0 );
+    CHECK_THROWS( (Move::Regrowth<Tspace>(pot2, spc2, j["moves"]["regrowfene"])) );
+  }
+  std::remove("bondlist.tcl"); // written by `Energy::Bonded` upon destruction
+}
+
+TEST_CASE("Incremental SASA", "Incremental surface area against full calculation")
+{
+  typedef Space<Geometry::Cuboid,DipoleParticle>::ParticleVector Tpvec;
+  Tmjson j = { {"length", 20.0} };
+  Geometry::Cuboid geo(j);
+  Energy::IncrementalSASA<Geometry::Cuboid> sasa(1.4, 200);
+  auto full = [&](const Tpvec &p) {
+    Energy::IncrementalSASA<Geometry::Cuboid> s(1.4, 200);
+    s.init(geo, p);
+    return s.total();
+  };
+
+  // molecule straddling the periodic boundary vs. the same molecule in the middle
+  Tpvec p(3), q;
+  for (auto &a : p)
+    a.radius = 2.0;
+  p[0] = Point( 9.5, 0, 0);
+  p[1] = Point(-9.5, 0, 0);
+  p[2] = Point(-8.0, 1.0, 0);
+  q = p;
+  for (auto &a : q) {
+    a += Point(10, 0, 0);
+    geo.boundary(a);
+  }
+  sasa.init(geo, p);
+  CHECK( sasa.total() == Approx(full(q)) );
+  CHECK( sasa.total() < 3*4*pc::pi*std::pow(2.0+1.4, 2) - 1 );
+
+  // random displacements, accepted and rejected
+  p.resize(40);
+  for (size_t i=3; i<p.size(); i++) {
+    p[i].radius = 1.0 + (i % 3);
+    geo.randompos(p[i]);
+  }
+  sasa.init(geo, p);
+  double u = sasa.total();
+  for (int n=0; n<100; n++) {
+    auto trial = p;
+    std::vector<int> index = { int(slump.range(0, p.size()-1)) };
+    if (n % 4 == 0)
+      index.push_back( slump.range(0, p.size()-1) );
+    for (auto i : index) {
+      trial[i].translate(geo, Point(slump.half(), slump.half(), slump.half()) * 6);
+      geo.boundary(trial[i]);
+    }
+    std::sort(index.begin(), index.end());
+    index.erase(std::unique(index.begin(), index.end()), index.end());
+    double du = sasa.propose(geo, trial, index, [](int) { return 1.0; });
+    CHECK( u + du == Approx(full(trial)) );
+    if (n % 2 == 0) {
+      sasa.accept();
+      p = trial;
+      u += du;
+    } else
+      sasa.reject();
+    CHECK( sasa.total() == Approx(full(p)) );
+  }
+}
+
+/* energy term that is not a sum of pair energies */
+template<class Tspace>
+struct ManybodyCharge : public Energy::Energybase<Tspace>
+{
+  string _info() override { return string(); }
+  auto tuple() -> decltype(std::make_tuple(this)) { return std::make_tuple(this); }
+  double i2all(typename Tspace::ParticleVector &p, int i) override {
+    double q = 0;
+    for (auto &a : p)
+      q += a.charge;
+    return q * q;
+  }
+};
+
+TEST_CASE("Titration site cache", "Cached swap move energies against full evaluation")
+{
+  typedef Space<Geometry::Cuboid,DipoleParticle> Tspace;
+  Tmjson j = {
+    {"system", { {"temperature", 298.0}, {"geometry", { {"length", 30.0} }} }},
+    {"atomlist", {
+      {"swA", { {"q", 0.0}, {"r", 2.0} }},
+      {"swHA", { {"q", 1.0}, {"r", 2.0} }},
+      {"swNa", { {"q", 1.0}, {"r", 1.5}, {"dp", 4.0} }},
+      {"swCl", { {"q",-1.0}, {"r", 1.5}, {"dp", 4.0} }} }},
+    {"moleculelist", {
+      {"swsites", { {"atoms", "swA"}, {"atomic", true}, {"Ninit", 10}, {"bulkinsert", "rsa"} }},
+      {"swsalt", { {"atoms", "swNa swCl"}, {"atomic", true}, {"Ninit", 10}, {"bulkinsert", "rsa"} }} }},
+    {"energy", { {"nonbonded", { {"epsr", 80.0} }} }},
+    {"moves", {
+      {"titrate", { {"sitecache", true}, {"sitecheck", 0},
+        {"processes", { {"H-A", { {"bound", "swHA"}, {"free", "swA"}, {"pKd", 4.0}, {"pX", 4.0} }} }} }},
+      {"atomtranslate", { {"swsalt", { {"peratom", true} }} }} }}
+  };
+  Tspace spc(j);
+  auto pot = Energy::Nonbonded<Tspace,
+       Potential::CombinedPairPotential<Potential::Coulomb,Potential::HardSphere>>(j)
+       + Energy::EquilibriumEnergy<Tspace>(j);
+  Move::SwapMove<Tspace> sw(pot, spc, j["moves"]["titrate"]);
+  Move::AtomicTranslation<Tspace> at(pot, spc, j["moves"]["atomtranslate"]);
+
+  double u = Energy::systemEnergy(spc, pot, spc.p);
+  for (int i=0; i<50; i++) {
+    u += sw.move();
+    CHECK( u == Approx(Energy::systemEnergy(spc, pot, spc.p)) );
+    u += at.move();
+    CHECK( u == Approx(Energy::systemEnergy(spc, pot, spc.p)) );
+  }
+  CHECK( sw.getAcceptance() > 0 );
+
+  auto bad = pot + ManybodyCharge<Tspace>();
+  CHECK_THROWS( (Move::SwapMove<Tspace>(bad, spc, j["moves"]["titrate"])) );
+}
+
+/* virial pressure of a re-analysis: total, excess and sample count */
+template<class Tspace>
+std::vector<double> reanalysisResult(Tmjson &j, Tspace &spc)
+{
+  Energy::Hamiltonian<Tspace> pot(j, spc);
+  Analysis::CombinedAnalysis ana(j, pot, spc);
+  size_t nframes = Analysis::reanalyse(j, pot, spc, ana);
+  auto virial = ana.get<Analysis::VirialPressure<Tspace>>();
+  std::vector<double> v = { double(nframes) };
+  std::istringstream in(virial->info());
+  string line, word;
+  while (std::getline(in, line)) {
+    if (line.find("Number of sample events") != string::npos)
+      v.push_back( std::stod(line.substr(line.find_last_of(' '))) );
+    std::istringstream l(line);
+    if (l >> word && (word=="Ideal" || word=="Excess" || word=="Total")) {
+      double kT, mM;
+      if (l >> kT >> mM)
+        v.push_back(mM);
+    }
+  }
+  return v;
+}
+
+TEST_CASE("Cavity grid", "Incrementally updated cavity grid against a rebuilt grid")
+{
+  typedef Space<Geometry::Cuboid,DipoleParticle> Tspace;
+  Tmjson j = {
+    {"system", { {"temperature", 298.0}, {"geometry", { {"length", 30.0} }} }},
+    {"atomlist", {
+      {"MM", { {"r", 2.0} }},
+      {"cgNa", { {"q", 1.0}, {"r", 1.0}, {"dp", 3.0}, {"activity", 1.0} }},
+      {"cgCl", { {"q",-1.0}, {"r", 1.0}, {"dp", 3.0}, {"activity", 1.0} }} }},
+    {"moleculelist", {
+      {"cgmol", { {"structure", "unittests.aam"}, {"Ninit", 2}, {"bulkinsert", "rsa"} }},
+      {"cgsalt", { {"atoms", "cgNa cgCl"}, {"atomic", true}, {"Ninit", 15}, {"bulkinsert", "rsa"} }} }},
+    {"energy", { {"nonbonded", { {"epsr", 80.0}, {"eps", 0.1} }} }},
+    {"moves", {
+      {"atomtranslate", { {"cgsalt", Tmjson::object()} }},
+      {"moltransrot", { {"cgmol", { {"dp", 3.0}, {"dprot", 0.5} }} }},
+      {"atomgc", { {"molecule", "cgsalt"}, {"cavityprobe", 3.0} }} }}
+  };
+  Tspace spc(j);
+  auto pot = Energy::Nonbonded<Tspace,
+       Potential::CombinedPairPotential<Potential::Coulomb,Potential::LennardJones>>(j);
+  Move::AtomicTranslation<Tspace> at(pot, spc, j["moves"]["atomtranslate"]);
+  Move::TranslateRotate<Tspace> tr(pot, spc, j["moves"]["moltransrot"]);
+  Move::GrandCanonicalSalt<Tspace> gc(pot, spc, j["moves"]["atomgc"]);
+  Move::CavityGrid<Tspace> grid(spc, 3.0, 1.5);
+
+  auto check = [&]() {
+    grid.sync();
+    Move::CavityGrid<Tspace> fresh(spc, 3.0, 1.5);
+    CHECK( grid.fraction() == Approx(fresh.fraction()) );
+    bool same = true;
+    for (int n=0; n<2000; n++) {
+      Point a;
+      spc.geo.randompos(a);
+      same = same && (grid.isCavity(a) == fresh.isCavity(a));
+    }
+    CHECK( same );
+  };
+  for (int i=0; i<20; i++) {
+    for (int n=0; n<20; n++) {
+      at.move();
+      tr.move();
+      if (i % 2 == 0)
+        gc.move(); // registers insertions and deletions in its own grid
+    }
+    check();
+  }
+
+  // particles moved before a registered deletion are followed to their new index
+  for (int n=0; n<3; n++) {
+    auto salt = spc.findMolecules("cgsalt").front();
+    Point last = spc.p[salt->back()];
+    while (spc.p[salt->back()] == last) // particle taking the place of the erased one
+      at.move();
+    int k = salt->front() + n;
+    grid.erase(k);
+    spc.erase(k);
+    check();
+  }
+
+  CHECK( gc.getAcceptance() > 0 );
+
+  spc.p[0].translate(spc.geo, Point(5, 0, 0)); // outside of moves
+  spc.trial[0] = spc.p[0];
+  grid.rebuild();
+  check();
+}
+
+TEST_CASE("Reanalysis", "Re-analysis of a trajectory with one and several threads")
+{
+  typedef Space<Geometry::Cuboid,DipoleParticle> Tspace;
+  Tmjson j = {
+    {"system", { {"temperature", 298.0}, {"geometry", { {"length", 30.0} }} }},
+    {"atomlist", {
+      {"reNa", { {"q", 1.0}, {"r", 1.5}, {"eps", 0.05} }},
+      {"reCl", { {"q",-1.0}, {"r", 2.0}, {"eps", 0.05} }} }},
+    {"moleculelist", {
+      {"resalt", { {"atoms", "reNa reCl"}, {"atomic", true}, {"Ninit", 20} }} }},
+    {"energy", { {"coulomb+lj", { {"coulombtype", "plain"}, {"epsr", 80.0}, {"cutoff", 14.0} }} }},
+    {"analysis", { {"virial", { {"nstep", 1} }}, {"_jsonfile", ""} }},
+    {"reanalysis", { {"file", "reanalysis.xtc"}, {"trump", true} }}
+  };
+  Tspace spc(j);
+  {
+    FormatXTC xtc(spc.geo.len.x());
+    for (int frame=0; frame<7; frame++) {
+      for (auto &a : spc.p)
+        spc.geo.randompos(a);
+      xtc.setbox(spc.geo.len);
+      xtc.save("reanalysis.xtc", spc.p);
+    }
+  }
+  auto p = spc.p;
+  auto serial = reanalysisResult(j, spc);
+  CHECK( serial[0] == 7 );
+  CHECK( serial[1] == 7 );
+  CHECK( serial.size() == 5 );
+
+  for (int threads : {2, 3, 7, 10}) {
+    spc.p = spc.trial = p;
+    j["reanalysis"]["threads"] = threads;
+    auto parallel = reanalysisResult(j, spc);
+    REQUIRE( parallel.size() == serial.size() );
+    for (size_t i=0; i<serial.size(); i++)
+      CHECK( parallel[i] == Approx(serial[i]) );
+  }
+  std::remove("reanalysis.xtc");
+  std::ifstream idx("reanalysis.xtc.idx");
+  CHECK( !idx ); // index cache is opt-in
+}
+
 TEST_CASE("Groups", "Check group range and size properties")
 {
   Group g(2,5);           // first, last particle
@@ -250,6 +861,47 @@ TEST_CASE("Space", "Space tests")
   //spc.insert(a);
 }
 
+/* check minimum image and boundaries of periodic cuboids; `pbcz` is false for slits */
+template<typename Tgeometry>
+void checkPeriodic(Tgeometry &geo, bool pbcz=true) {
+  Point L = geo.len, h = 0.5*L, d(0.3,-0.2,0.1);
+  Point a(0,0,0), b;
+
+  // points at +-len/2 are half a box apart in periodic directions
+  for (int k=0; k<3; k++) {
+    b = a;
+    b[k] = h[k];
+    CHECK( geo.sqdist(a,b) == Approx(h[k]*h[k]) );
+    b[k] = -h[k];
+    CHECK( geo.sqdist(a,b) == Approx(h[k]*h[k]) );
+  }
+  a = -h + Point(0.1,0.1,0.1);
+  b = h - Point(0.1,0.1,0.1);
+  double z = pbcz ? 0.2 : L.z()-0.2;
+  CHECK( geo.sqdist(a,b) == Approx(0.2*0.2 + 0.2*0.2 + z*z) );
+  CHECK( geo.vdist(a,b).x() == Approx(0.2) );
+
+  // separations of several box lengths
+  a = Point(1,2,3);
+  for (int n : {-3,-2,-1,1,2,3}) {
+    b = a + d;
+    b.x() += n*L.x();
+    b.y() -= n*L.y();
+    if (pbcz)
+      b.z() += n*L.z();
+    CHECK( geo.sqdist(a,b) == Approx(d.squaredNorm()) );
+    CHECK( geo.vdist(b,a).x() == Approx(d.x()) );
+    CHECK( geo.vdist(b,a).y() == Approx(d.y()) );
+    CHECK( geo.vdist(b,a).z() == Approx(d.z()) );
+    geo.boundary(b);
+    CHECK( (b-a-d).norm() < 1e-9 );
+  }
+  b = Point(2.5*L.x(), -3.5*L.y()+0.1, 0);
+  geo.boundary(b);
+  CHECK( std::fabs(b.x()) == Approx(h.x()) );
+  CHECK( b.y() == Approx(-h.y()+0.1) );
+}
+
 TEST_CASE("Geometries", "Geometry tests")
 {
   Geometry::Sphere geoSph(1000);
@@ -259,6 +911,24 @@ TEST_CASE("Geometries", "Geometry tests")
   double y = geoCyl.sqdist(a,b);
   CHECK( x==Approx(16+64) );
   CHECK( x==Approx(y) );
+
+  Tmjson j = { {"length", {10.0,12.0,14.0}} };
+  Geometry::Cuboid geoCuboid(j);
+  Geometry::Cuboidslit geoSlit(j);
+  checkPeriodic(geoCuboid);
+  checkPeriodic(geoSlit, false);
+  CHECK_THROWS( (Geometry::Cube(j)) );
+
+  j = { {"length", 10.0} };
+  Geometry::Cube geoCube(j);
+  checkPeriodic(geoCube);
+  CHECK_THROWS( geoCube.setlen(Point(10, 10, 12)) );
+  Geometry::Cuboid &base = geoCube;
+  CHECK_THROWS( base.setlen(Point(10, 12, 10)) );
+  geoCube.setVolume(2000);
+  CHECK( geoCube.len.y() == Approx(geoCube.len.x()) );
+  CHECK( geoCube.len.z() == Approx(geoCube.len.x()) );
+  CHECK( geoCube.getVolume() == Approx(2000) );
 }
 
 TEST_CASE("Random numbers", "Check random number generator")
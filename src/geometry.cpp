@@ -365,6 +365,23 @@ namespace Faunus
 
     Cuboidslit::Cuboidslit( Tmjson &j ) : Cuboid(j) { name += " (XY-periodicity)"; }
 
+    Cube::Cube() { name = "Cube"; }
+
+    Cube::Cube( Tmjson &j ) : Cuboid(j)
+    {
+        name = "Cube";
+        if ( j.value<string>("scaledir", "XYZ") != "XYZ" )
+            throw std::runtime_error(name + ": only isotropic (XYZ) scaling is allowed");
+        setlen(len);
+    }
+
+    void Cube::setlen( const Point &l )
+    {
+        if ( std::abs(l.x() - l.y()) > 1e-9 * l.x() || std::abs(l.x() - l.z()) > 1e-9 * l.x())
+            throw std::runtime_error("Cube: sidelengths must be equal");
+        Cuboid::setlen(l);
+    }
+
     /**
      * @param length Length of the Cylinder (angstrom)
      * @param radius Radius of the Cylinder (angstrom)
@@ -61,6 +61,7 @@
 #include <string.h>
 #include <math.h>
 #include <limits.h>
+#include <sys/types.h>
 
 
 /* get fixed-width types if we are using ANSI C99 */
@@ -275,6 +276,24 @@ xdrfile_close(XDRFILE *xfp)
 	return ret; /* return 0 if ok */
 }
 
+long long
+xdrfile_tell(XDRFILE *xfp)
+{
+	if(xfp==NULL)
+		return -1;
+	return (long long)ftello(xfp->fp);
+}
+
+int
+xdrfile_seek(XDRFILE *xfp, long long offset, int whence)
+{
+	if(xfp==NULL)
+		return exdrENDOFFILE;
+	if(fseeko(xfp->fp,(off_t)offset,whence)!=0)
+		return exdrENDOFFILE;
+	return exdrOK;
+}
+
 
 
 int 